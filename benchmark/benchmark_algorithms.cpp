@@ -0,0 +1,214 @@
+#include "NamedTupleAlgorithms.hpp"
+#include "NamedTupleQuery.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+using Trade = mguid::NamedTuple<mguid::NamedType<"ts", std::int64_t>, mguid::NamedType<"id", int>,
+                                mguid::NamedType<"price", double>, mguid::NamedType<"qty", int>>;
+using TradeColumns =
+    mguid::NamedTupleColumns<mguid::NamedType<"ts", std::int64_t>, mguid::NamedType<"id", int>,
+                             mguid::NamedType<"price", double>, mguid::NamedType<"qty", int>>;
+
+struct TradeStruct {
+  std::int64_t ts;
+  int id;
+  double price;
+  int qty;
+};
+
+std::vector<TradeStruct> make_structs(std::size_t count) {
+  std::mt19937_64 engine{42};
+  std::uniform_int_distribution<std::int64_t> ts{0, 1'000'000};
+  std::uniform_int_distribution<int> small{-100, 100};
+  std::uniform_real_distribution<double> price{0.0, 100.0};
+  std::vector<TradeStruct> result(count);
+  std::ranges::generate(result, [&] {
+    return TradeStruct{ts(engine), small(engine), price(engine), small(engine)};
+  });
+  return result;
+}
+
+std::vector<Trade> make_tuples(std::size_t count) {
+  std::vector<Trade> result;
+  result.reserve(count);
+  for (const auto& trade : make_structs(count)) {
+    result.emplace_back(trade.ts, trade.id, trade.price, trade.qty);
+  }
+  return result;
+}
+
+TradeColumns make_columns(std::size_t count) {
+  TradeColumns result;
+  result.reserve(count);
+  for (const auto& trade : make_structs(count)) {
+    result.emplace_back(trade.ts, trade.id, trade.price, trade.qty);
+  }
+  return result;
+}
+
+void BM_SumHandWritten(benchmark::State& state) {
+  const auto trades = make_structs(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    double total{0.0};
+    for (const auto& trade : trades) { total += trade.price; }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SumRange(benchmark::State& state) {
+  const auto trades = make_tuples(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) { benchmark::DoNotOptimize(mguid::sum<"price">(trades)); }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SumColumns(benchmark::State& state) {
+  const auto columns = make_columns(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) { benchmark::DoNotOptimize(mguid::sum<"price">(columns)); }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_MinMaxHandWritten(benchmark::State& state) {
+  const auto trades = make_structs(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    auto [min, max] = std::ranges::minmax_element(trades, {}, &TradeStruct::ts);
+    benchmark::DoNotOptimize(min->ts);
+    benchmark::DoNotOptimize(max->ts);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_MinMaxRange(benchmark::State& state) {
+  const auto trades = make_tuples(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) { benchmark::DoNotOptimize(mguid::min_max<"ts">(trades)); }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_MinMaxColumns(benchmark::State& state) {
+  const auto columns = make_columns(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) { benchmark::DoNotOptimize(mguid::min_max<"ts">(columns)); }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_FilterHandWritten(benchmark::State& state) {
+  const auto trades = make_structs(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::vector<TradeStruct> result;
+    std::ranges::copy_if(trades, std::back_inserter(result),
+                         [](const TradeStruct& trade) { return trade.qty > 50; });
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_FilterRange(benchmark::State& state) {
+  const auto trades = make_tuples(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    auto result = mguid::filter<"qty">(trades, [](int qty) { return qty > 50; });
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_FilterColumns(benchmark::State& state) {
+  const auto columns = make_columns(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    auto result = mguid::filter<"qty">(columns, [](int qty) { return qty > 50; });
+    benchmark::DoNotOptimize(result.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SortHandWritten(benchmark::State& state) {
+  const auto trades = make_structs(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto copy = trades;
+    state.ResumeTiming();
+    std::ranges::sort(copy, [](const TradeStruct& lhs, const TradeStruct& rhs) {
+      return lhs.ts < rhs.ts || (!(rhs.ts < lhs.ts) && lhs.id < rhs.id);
+    });
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SortRange(benchmark::State& state) {
+  const auto trades = make_tuples(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto copy = trades;
+    state.ResumeTiming();
+    mguid::sort_by<"ts", "id">(copy);
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SortColumns(benchmark::State& state) {
+  const auto columns = make_columns(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto copy = columns;
+    state.ResumeTiming();
+    mguid::sort_by<"ts", "id">(copy);
+    benchmark::DoNotOptimize(copy.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+struct GroupTotals {
+  double price;
+  std::size_t count;
+};
+
+void BM_GroupByHandWritten(benchmark::State& state) {
+  const auto trades = make_structs(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::unordered_map<int, GroupTotals> groups;
+    for (const auto& trade : trades) {
+      if (trade.qty > 50) {
+        auto& totals = groups[trade.id];
+        totals.price += trade.price;
+        ++totals.count;
+      }
+    }
+    benchmark::DoNotOptimize(groups.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_GroupByQuery(benchmark::State& state) {
+  const auto columns = make_columns(static_cast<std::size_t>(state.range(0)));
+  const auto query = mguid::scan(columns)
+                         .where<"qty">(mguid::gt(50))
+                         .threads(static_cast<std::size_t>(state.range(1)));
+  for (auto _ : state) {
+    auto groups = query.group_by<"id">().agg(mguid::sum_of<"price">, mguid::count_of);
+    benchmark::DoNotOptimize(groups.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}  // namespace
+
+BENCHMARK(BM_SumHandWritten)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_SumRange)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_SumColumns)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_MinMaxHandWritten)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_MinMaxRange)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_MinMaxColumns)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_FilterHandWritten)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_FilterRange)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_FilterColumns)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_SortHandWritten)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_SortRange)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_SortColumns)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_GroupByHandWritten)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_GroupByQuery)->Ranges({{1 << 10, 1 << 20}, {1, 4}})->UseRealTime();
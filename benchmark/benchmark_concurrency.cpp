@@ -0,0 +1,146 @@
+#include "NamedTupleRing.hpp"
+#include "SeqlockNamedTuple.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <thread>
+
+namespace {
+using SharedQuote = mguid::SeqlockNamedTuple<
+    mguid::NamedType<"seq", std::uint64_t>, mguid::NamedType<"bid", double>,
+    mguid::NamedType<"ask", double>, mguid::NamedType<"bid_size", std::int64_t>,
+    mguid::NamedType<"ask_size", std::int64_t>, mguid::NamedType<"ts", std::int64_t>>;
+using Quote = SharedQuote::Snapshot;
+
+void update(Quote& quote, std::uint64_t seq) {
+  quote.get<"seq">() = seq;
+  quote.get<"bid">() = 100.0 + static_cast<double>(seq % 100) * 0.01;
+  quote.get<"ask">() = quote.get<"bid">() + 0.01;
+  quote.get<"ts">() = static_cast<std::int64_t>(seq);
+}
+
+class SeqlockPublisher {
+public:
+  void publish(std::uint64_t seq) {
+    m_quote.publish([seq](Quote& quote) { update(quote, seq); });
+  }
+
+  Quote read() const { return m_quote.load(); }
+
+private:
+  SharedQuote m_quote{};
+};
+
+class SharedMutexPublisher {
+public:
+  void publish(std::uint64_t seq) {
+    const std::unique_lock lock{m_mutex};
+    update(m_quote, seq);
+  }
+
+  Quote read() const {
+    const std::shared_lock lock{m_mutex};
+    return m_quote;
+  }
+
+private:
+  mutable std::shared_mutex m_mutex{};
+  Quote m_quote{};
+};
+
+// the first thread publishes as fast as it can while every other thread reads
+template <typename Publisher>
+void BM_PublishRead(benchmark::State& state) {
+  static Publisher publisher{};
+  if (state.thread_index() == 0) {
+    std::uint64_t seq{0};
+    for (auto _ : state) { publisher.publish(++seq); }
+    state.counters["publications"] =
+        benchmark::Counter(static_cast<double>(seq), benchmark::Counter::kIsRate);
+  } else {
+    for (auto _ : state) { benchmark::DoNotOptimize(publisher.read()); }
+    state.counters["reads"] = benchmark::Counter(static_cast<double>(state.iterations()),
+                                                 benchmark::Counter::kIsRate);
+  }
+}
+
+BENCHMARK(BM_PublishRead<SeqlockPublisher>)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK(BM_PublishRead<SharedMutexPublisher>)->ThreadRange(2, 16)->UseRealTime();
+
+constexpr std::size_t kPipelineCapacity{1024};
+constexpr std::size_t kPipelineBatch{64};
+
+template <typename Ring>
+class RingPipe {
+public:
+  bool push(const Quote& quote) { return m_ring->try_push(quote); }
+
+  std::size_t pop(std::span<Quote> out) { return m_ring->pop_n(out); }
+
+private:
+  std::unique_ptr<Ring> m_ring{std::make_unique<Ring>()};
+};
+
+class MutexPipe {
+public:
+  bool push(const Quote& quote) {
+    const std::lock_guard lock{m_mutex};
+    if (m_queue.size() == kPipelineCapacity) { return false; }
+    m_queue.push_back(quote);
+    return true;
+  }
+
+  std::size_t pop(std::span<Quote> out) {
+    const std::lock_guard lock{m_mutex};
+    std::size_t count{0};
+    for (; count < out.size() && !m_queue.empty(); ++count) {
+      out[count] = m_queue.front();
+      m_queue.pop_front();
+    }
+    return count;
+  }
+
+private:
+  std::mutex m_mutex{};
+  std::deque<Quote> m_queue{};
+};
+
+// the benchmark thread produces quotes that a second thread consumes in batches
+template <typename Pipe>
+void BM_Pipeline(benchmark::State& state) {
+  Pipe pipe{};
+  std::atomic<bool> done{false};
+  std::uint64_t consumed{0};
+  std::thread consumer{[&] {
+    std::array<Quote, kPipelineBatch> out;
+    while (!done.load(std::memory_order_acquire)) {
+      const auto count = pipe.pop(std::span{out});
+      if (count == 0) { std::this_thread::yield(); }
+      consumed += count;
+    }
+    while (const auto count = pipe.pop(std::span{out})) { consumed += count; }
+  }};
+  Quote quote{};
+  std::uint64_t seq{0};
+  for (auto _ : state) {
+    update(quote, ++seq);
+    while (!pipe.push(quote)) { std::this_thread::yield(); }
+  }
+  done.store(true, std::memory_order_release);
+  consumer.join();
+  state.SetItemsProcessed(static_cast<std::int64_t>(consumed));
+}
+
+BENCHMARK(BM_Pipeline<RingPipe<mguid::NamedTupleRing<Quote, kPipelineCapacity>>>)->UseRealTime();
+BENCHMARK(BM_Pipeline<RingPipe<mguid::MpmcNamedTupleRing<Quote, kPipelineCapacity>>>)
+    ->UseRealTime();
+BENCHMARK(BM_Pipeline<MutexPipe>)->UseRealTime();
+}  // namespace
@@ -0,0 +1,150 @@
+#include "NamedTupleJson.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(NAMED_TUPLE_HAS_NLOHMANN_JSON)
+#include <nlohmann/json.hpp>
+#endif
+
+#if defined(NAMED_TUPLE_HAS_SIMDJSON)
+#include <simdjson.h>
+#endif
+
+namespace {
+using Quote = mguid::NamedTuple<mguid::NamedType<"symbol", std::string>,
+                                mguid::NamedType<"ts", std::int64_t>,
+                                mguid::NamedType<"bid", double>, mguid::NamedType<"ask", double>,
+                                mguid::NamedType<"size", std::int32_t>>;
+
+constexpr std::size_t kRecords{1024};
+
+std::vector<Quote> make_quotes() {
+  std::mt19937_64 engine{42};
+  std::uniform_real_distribution<double> price{90.0, 110.0};
+  std::uniform_int_distribution<std::int32_t> size{1, 10'000};
+  std::vector<Quote> quotes{};
+  quotes.reserve(kRecords);
+  for (std::size_t index{0}; index < kRecords; ++index) {
+    const double bid = price(engine);
+    quotes.emplace_back(std::string{"SYM"} + std::to_string(index % 64),
+                        static_cast<std::int64_t>(1'700'000'000'000 + index), bid, bid + 0.01,
+                        size(engine));
+  }
+  return quotes;
+}
+
+std::vector<std::string> make_messages() {
+  std::vector<std::string> messages{};
+  for (const auto& quote : make_quotes()) { messages.push_back(mguid::to_json(quote)); }
+  return messages;
+}
+
+void BM_EncodeNamedTuple(benchmark::State& state) {
+  const auto quotes = make_quotes();
+  std::string out{};
+  for (auto _ : state) {
+    for (const auto& quote : quotes) {
+      out.clear();
+      mguid::to_json(quote, out);
+      benchmark::DoNotOptimize(out.data());
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kRecords));
+}
+BENCHMARK(BM_EncodeNamedTuple);
+
+void BM_DecodeNamedTuple(benchmark::State& state) {
+  const auto messages = make_messages();
+  Quote quote{};
+  for (auto _ : state) {
+    for (const auto& message : messages) {
+      benchmark::DoNotOptimize(mguid::from_json(message, quote));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kRecords));
+}
+BENCHMARK(BM_DecodeNamedTuple);
+
+void BM_DecodeNamedTupleStream(benchmark::State& state) {
+  std::string stream{};
+  for (const auto& message : make_messages()) { stream += message + '\n'; }
+  for (auto _ : state) {
+    mguid::JsonStreamDecoder<Quote> decoder{};
+    // feed the stream in chunks that split records to include the cost of buffering
+    for (std::size_t offset{0}; offset < stream.size(); offset += 4096) {
+      decoder.feed(std::string_view{stream}.substr(offset, 4096),
+                   [](Quote&& quote) { benchmark::DoNotOptimize(quote); });
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kRecords));
+}
+BENCHMARK(BM_DecodeNamedTupleStream);
+
+#if defined(NAMED_TUPLE_HAS_NLOHMANN_JSON)
+void BM_EncodeNlohmann(benchmark::State& state) {
+  const auto quotes = make_quotes();
+  std::string out{};
+  for (auto _ : state) {
+    for (const auto& quote : quotes) {
+      const nlohmann::json json{{"symbol", quote.get<"symbol">()},
+                                {"ts", quote.get<"ts">()},
+                                {"bid", quote.get<"bid">()},
+                                {"ask", quote.get<"ask">()},
+                                {"size", quote.get<"size">()}};
+      out = json.dump();
+      benchmark::DoNotOptimize(out.data());
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kRecords));
+}
+BENCHMARK(BM_EncodeNlohmann);
+
+void BM_DecodeNlohmann(benchmark::State& state) {
+  const auto messages = make_messages();
+  Quote quote{};
+  for (auto _ : state) {
+    for (const auto& message : messages) {
+      const auto json = nlohmann::json::parse(message);
+      quote.get<"symbol">() = json["symbol"].get<std::string>();
+      quote.get<"ts">() = json["ts"].get<std::int64_t>();
+      quote.get<"bid">() = json["bid"].get<double>();
+      quote.get<"ask">() = json["ask"].get<double>();
+      quote.get<"size">() = json["size"].get<std::int32_t>();
+      benchmark::DoNotOptimize(quote);
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kRecords));
+}
+BENCHMARK(BM_DecodeNlohmann);
+#endif
+
+#if defined(NAMED_TUPLE_HAS_SIMDJSON)
+void BM_DecodeSimdjson(benchmark::State& state) {
+  std::vector<simdjson::padded_string> messages{};
+  for (const auto& message : make_messages()) { messages.emplace_back(message); }
+  simdjson::ondemand::parser parser{};
+  Quote quote{};
+  for (auto _ : state) {
+    for (const auto& message : messages) {
+      auto document = parser.iterate(message);
+      // fields are read in document order, the fastest access pattern of the on demand API
+      quote.get<"symbol">() = std::string_view{document["symbol"]};
+      quote.get<"ts">() = std::int64_t{document["ts"]};
+      quote.get<"bid">() = double{document["bid"]};
+      quote.get<"ask">() = double{document["ask"]};
+      quote.get<"size">() = static_cast<std::int32_t>(std::int64_t{document["size"]});
+      benchmark::DoNotOptimize(quote);
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kRecords));
+}
+BENCHMARK(BM_DecodeSimdjson);
+#endif
+}  // namespace
@@ -0,0 +1,430 @@
+#include "NamedTuple.hpp"
+#include "NamedTupleHash.hpp"
+#include "SplitNamedTuple.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+using Quote =
+    mguid::NamedTuple<mguid::NamedType<"ts", std::int64_t>, mguid::NamedType<"bid", double>,
+                      mguid::NamedType<"ask", double>, mguid::NamedType<"size", int>>;
+using QuoteTuple = std::tuple<std::int64_t, double, double, int>;
+
+struct QuoteStruct {
+  std::int64_t ts;
+  double bid;
+  double ask;
+  int size;
+
+  auto operator<=>(const QuoteStruct&) const = default;
+};
+
+using Tagged = mguid::NamedTuple<mguid::NamedType<"symbol", std::string>,
+                                 mguid::NamedType<"venue", std::string>,
+                                 mguid::NamedType<"ts", std::int64_t>>;
+using TaggedTuple = std::tuple<std::string, std::string, std::int64_t>;
+
+struct TaggedStruct {
+  std::string symbol;
+  std::string venue;
+  std::int64_t ts;
+};
+
+constexpr std::size_t kCount{4096};
+
+std::vector<QuoteStruct> make_structs(std::size_t count) {
+  std::mt19937_64 engine{7};
+  std::uniform_int_distribution<std::int64_t> ts{0, 1'000'000};
+  std::uniform_real_distribution<double> price{90.0, 110.0};
+  std::uniform_int_distribution<int> size{1, 1000};
+  std::vector<QuoteStruct> result(count);
+  std::ranges::generate(result, [&] {
+    return QuoteStruct{ts(engine), price(engine), price(engine), size(engine)};
+  });
+  return result;
+}
+
+std::vector<Quote> make_named(std::size_t count) {
+  std::vector<Quote> result;
+  result.reserve(count);
+  for (const auto& quote : make_structs(count)) {
+    result.emplace_back(quote.ts, quote.bid, quote.ask, quote.size);
+  }
+  return result;
+}
+
+std::vector<QuoteTuple> make_tuples(std::size_t count) {
+  std::vector<QuoteTuple> result;
+  result.reserve(count);
+  for (const auto& quote : make_structs(count)) {
+    result.emplace_back(quote.ts, quote.bid, quote.ask, quote.size);
+  }
+  return result;
+}
+
+constexpr std::size_t boost_hash_combine(std::size_t seed, std::size_t value) noexcept {
+  return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6U) + (seed >> 2U));
+}
+
+// Access
+
+void BM_AccessNamedTuple(benchmark::State& state) {
+  const auto quotes = make_named(kCount);
+  for (auto _ : state) {
+    double spread{0.0};
+    for (const auto& quote : quotes) { spread += quote.get<"ask">() - quote.get<"bid">(); }
+    benchmark::DoNotOptimize(spread);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+void BM_AccessStdTuple(benchmark::State& state) {
+  const auto quotes = make_tuples(kCount);
+  for (auto _ : state) {
+    double spread{0.0};
+    for (const auto& quote : quotes) { spread += std::get<2>(quote) - std::get<1>(quote); }
+    benchmark::DoNotOptimize(spread);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+void BM_AccessStruct(benchmark::State& state) {
+  const auto quotes = make_structs(kCount);
+  for (auto _ : state) {
+    double spread{0.0};
+    for (const auto& quote : quotes) { spread += quote.ask - quote.bid; }
+    benchmark::DoNotOptimize(spread);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+// Set
+
+void BM_SetNamedTuple(benchmark::State& state) {
+  auto quotes = make_named(kCount);
+  for (auto _ : state) {
+    for (auto& quote : quotes) { quote.set<"size">(quote.get<"size">() + 1); }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+void BM_SetStdTuple(benchmark::State& state) {
+  auto quotes = make_tuples(kCount);
+  for (auto _ : state) {
+    for (auto& quote : quotes) { std::get<3>(quote) = std::get<3>(quote) + 1; }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+void BM_SetStruct(benchmark::State& state) {
+  auto quotes = make_structs(kCount);
+  for (auto _ : state) {
+    for (auto& quote : quotes) { quote.size = quote.size + 1; }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+// Copy and move
+
+template <typename Type>
+void BM_Copy(benchmark::State& state) {
+  const Type source{std::string(32, 's'), std::string(32, 'v'), 42};
+  for (auto _ : state) {
+    Type copy{source};
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+template <typename Type>
+void BM_Move(benchmark::State& state) {
+  Type source{std::string(32, 's'), std::string(32, 'v'), 42};
+  for (auto _ : state) {
+    Type moved{std::move(source)};
+    benchmark::DoNotOptimize(moved);
+    source = std::move(moved);
+  }
+}
+
+// Comparison
+
+template <typename Type>
+void BM_Equal(benchmark::State& state) {
+  const auto values = [] {
+    if constexpr (std::is_same_v<Type, Quote>) {
+      return make_named(kCount);
+    } else if constexpr (std::is_same_v<Type, QuoteTuple>) {
+      return make_tuples(kCount);
+    } else {
+      return make_structs(kCount);
+    }
+  }();
+  for (auto _ : state) {
+    std::size_t equal{0};
+    for (std::size_t i{1}; i < values.size(); ++i) {
+      equal += static_cast<std::size_t>(values[i - 1] == values[i]);
+    }
+    benchmark::DoNotOptimize(equal);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+template <typename Type>
+void BM_ThreeWay(benchmark::State& state) {
+  const auto values = [] {
+    if constexpr (std::is_same_v<Type, Quote>) {
+      return make_named(kCount);
+    } else if constexpr (std::is_same_v<Type, QuoteTuple>) {
+      return make_tuples(kCount);
+    } else {
+      return make_structs(kCount);
+    }
+  }();
+  for (auto _ : state) {
+    std::size_t less{0};
+    for (std::size_t i{1}; i < values.size(); ++i) {
+      less += static_cast<std::size_t>((values[i - 1] <=> values[i]) < 0);
+    }
+    benchmark::DoNotOptimize(less);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+// Specialized comparison against the generic element by element comparison
+
+using Key = mguid::NamedTuple<mguid::NamedType<"shard", std::uint16_t>,
+                              mguid::NamedType<"venue", std::uint16_t>,
+                              mguid::NamedType<"seq", std::uint32_t>>;
+
+constexpr auto generic_equal = [](const Key& lhs, const Key& rhs) {
+  return lhs.get<0>() == rhs.get<0>() && lhs.get<1>() == rhs.get<1>() &&
+         lhs.get<2>() == rhs.get<2>();
+};
+
+constexpr auto generic_three_way = [](const Key& lhs, const Key& rhs) {
+  return std::tie(lhs.get<0>(), lhs.get<1>(), lhs.get<2>()) <=>
+         std::tie(rhs.get<0>(), rhs.get<1>(), rhs.get<2>());
+};
+
+std::vector<Key> make_keys(std::size_t count) {
+  std::mt19937_64 engine{11};
+  // few distinct shards and venues so that most comparisons look at every element
+  std::uniform_int_distribution<std::uint32_t> small{0, 3};
+  std::uniform_int_distribution<std::uint32_t> seq{0, 1'000'000};
+  std::vector<Key> result;
+  result.reserve(count);
+  for (std::size_t i{0}; i < count; ++i) {
+    result.emplace_back(static_cast<std::uint16_t>(small(engine)),
+                        static_cast<std::uint16_t>(small(engine)), seq(engine));
+  }
+  return result;
+}
+
+template <bool Specialized>
+void BM_KeyEqual(benchmark::State& state) {
+  const auto keys = make_keys(kCount);
+  for (auto _ : state) {
+    std::size_t equal{0};
+    for (std::size_t i{1}; i < keys.size(); ++i) {
+      if constexpr (Specialized) {
+        equal += static_cast<std::size_t>(keys[i - 1] == keys[i]);
+      } else {
+        equal += static_cast<std::size_t>(generic_equal(keys[i - 1], keys[i]));
+      }
+    }
+    benchmark::DoNotOptimize(equal);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+template <bool Specialized>
+void BM_KeyThreeWay(benchmark::State& state) {
+  const auto keys = make_keys(kCount);
+  for (auto _ : state) {
+    std::size_t less{0};
+    for (std::size_t i{1}; i < keys.size(); ++i) {
+      if constexpr (Specialized) {
+        less += static_cast<std::size_t>((keys[i - 1] <=> keys[i]) < 0);
+      } else {
+        less += static_cast<std::size_t>(generic_three_way(keys[i - 1], keys[i]) < 0);
+      }
+    }
+    benchmark::DoNotOptimize(less);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+template <bool Specialized>
+void BM_KeySort(benchmark::State& state) {
+  const auto keys = make_keys(kCount);
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto copy = keys;
+    state.ResumeTiming();
+    if constexpr (Specialized) {
+      std::ranges::sort(copy, [](const Key& lhs, const Key& rhs) {
+        return mguid::compare_by<"shard", "venue", "seq">(lhs, rhs) < 0;
+      });
+    } else {
+      std::ranges::sort(copy, [](const Key& lhs, const Key& rhs) {
+        return generic_three_way(lhs, rhs) < 0;
+      });
+    }
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+// Hashing
+
+void BM_HashNamedTuple(benchmark::State& state) {
+  const auto quotes = make_named(kCount);
+  for (auto _ : state) {
+    std::size_t seed{0};
+    for (const auto& quote : quotes) { seed ^= std::hash<Quote>{}(quote); }
+    benchmark::DoNotOptimize(seed);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+void BM_HashByTags(benchmark::State& state) {
+  const auto quotes = make_named(kCount);
+  for (auto _ : state) {
+    std::size_t seed{0};
+    for (const auto& quote : quotes) { seed ^= mguid::hash_by<"ts", "size">(quote); }
+    benchmark::DoNotOptimize(seed);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+void BM_HashStruct(benchmark::State& state) {
+  const auto quotes = make_structs(kCount);
+  for (auto _ : state) {
+    std::size_t seed{0};
+    for (const auto& quote : quotes) {
+      seed = boost_hash_combine(seed, std::hash<std::int64_t>{}(quote.ts));
+      seed = boost_hash_combine(seed, std::hash<double>{}(quote.bid));
+      seed = boost_hash_combine(seed, std::hash<double>{}(quote.ask));
+      seed = boost_hash_combine(seed, std::hash<int>{}(quote.size));
+    }
+    benchmark::DoNotOptimize(seed);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+// Sorting
+
+void BM_SortNamedTuple(benchmark::State& state) {
+  const auto quotes = make_named(kCount);
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto copy = quotes;
+    state.ResumeTiming();
+    std::ranges::sort(copy, {}, [](const Quote& quote) { return quote.get<"ts">(); });
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+void BM_SortStdTuple(benchmark::State& state) {
+  const auto quotes = make_tuples(kCount);
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto copy = quotes;
+    state.ResumeTiming();
+    std::ranges::sort(copy, {}, [](const QuoteTuple& quote) { return std::get<0>(quote); });
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+void BM_SortStruct(benchmark::State& state) {
+  const auto quotes = make_structs(kCount);
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto copy = quotes;
+    state.ResumeTiming();
+    std::ranges::sort(copy, {}, &QuoteStruct::ts);
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kCount));
+}
+
+// Hot and cold splitting
+
+using WideOrder = mguid::NamedTuple<
+    mguid::NamedType<"id", std::uint64_t>, mguid::NamedType<"price", double>,
+    mguid::NamedType<"qty", std::int64_t>, mguid::NamedType<"account", std::string>,
+    mguid::NamedType<"venue", std::string>, mguid::NamedType<"fees", std::array<double, 16>>>;
+using SplitOrder = mguid::SplitNamedTuple<
+    mguid::HotTags<"price", "qty">, mguid::NamedType<"id", std::uint64_t>,
+    mguid::NamedType<"price", double>, mguid::NamedType<"qty", std::int64_t>,
+    mguid::NamedType<"account", std::string>, mguid::NamedType<"venue", std::string>,
+    mguid::NamedType<"fees", std::array<double, 16>>>;
+
+// sums the notional of every order, touching only the two hot elements
+template <typename Order>
+void BM_ScanHotElements(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  std::vector<Order> orders;
+  orders.reserve(count);
+  for (std::size_t index{0}; index < count; ++index) {
+    orders.emplace_back(WideOrder{index, static_cast<double>(index % 100),
+                                  static_cast<std::int64_t>(index % 7), "account", "venue",
+                                  std::array<double, 16>{}});
+  }
+  for (auto _ : state) {
+    double notional{0.0};
+    for (const auto& order : orders) {
+      notional += order.template get<"price">() * static_cast<double>(order.template get<"qty">());
+    }
+    benchmark::DoNotOptimize(notional);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}  // namespace
+
+BENCHMARK(BM_AccessNamedTuple);
+BENCHMARK(BM_AccessStdTuple);
+BENCHMARK(BM_AccessStruct);
+BENCHMARK(BM_SetNamedTuple);
+BENCHMARK(BM_SetStdTuple);
+BENCHMARK(BM_SetStruct);
+BENCHMARK(BM_Copy<Tagged>);
+BENCHMARK(BM_Copy<TaggedTuple>);
+BENCHMARK(BM_Copy<TaggedStruct>);
+BENCHMARK(BM_Move<Tagged>);
+BENCHMARK(BM_Move<TaggedTuple>);
+BENCHMARK(BM_Move<TaggedStruct>);
+BENCHMARK(BM_Equal<Quote>);
+BENCHMARK(BM_Equal<QuoteTuple>);
+BENCHMARK(BM_Equal<QuoteStruct>);
+BENCHMARK(BM_ThreeWay<Quote>);
+BENCHMARK(BM_ThreeWay<QuoteTuple>);
+BENCHMARK(BM_ThreeWay<QuoteStruct>);
+BENCHMARK(BM_KeyEqual<true>);
+BENCHMARK(BM_KeyEqual<false>);
+BENCHMARK(BM_KeyThreeWay<true>);
+BENCHMARK(BM_KeyThreeWay<false>);
+BENCHMARK(BM_KeySort<true>);
+BENCHMARK(BM_KeySort<false>);
+BENCHMARK(BM_HashNamedTuple);
+BENCHMARK(BM_HashByTags);
+BENCHMARK(BM_HashStruct);
+BENCHMARK(BM_SortNamedTuple);
+BENCHMARK(BM_SortStdTuple);
+BENCHMARK(BM_SortStruct);
+BENCHMARK(BM_ScanHotElements<WideOrder>)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_ScanHotElements<SplitOrder>)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,79 @@
+#include "NamedTuplePool.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace {
+using Request = mguid::NamedTuple<mguid::NamedType<"id", std::int64_t>,
+                                  mguid::NamedType<"route", std::string>,
+                                  mguid::NamedType<"deadline", double>>;
+
+constexpr std::size_t kBatch{64};
+
+void BM_RecordsStdAllocator(benchmark::State& state) {
+  std::allocator<Request> allocator;
+  std::vector<Request*> records(kBatch);
+  for (auto _ : state) {
+    for (auto& record : records) {
+      record = std::construct_at(allocator.allocate(1), std::int64_t{1}, "/quote", 0.5);
+    }
+    benchmark::DoNotOptimize(records.data());
+    for (auto* record : records) {
+      std::destroy_at(record);
+      allocator.deallocate(record, 1);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kBatch));
+}
+
+void BM_RecordsSynchronizedPool(benchmark::State& state) {
+  static std::pmr::synchronized_pool_resource resource;
+  std::pmr::polymorphic_allocator<Request> allocator{&resource};
+  std::vector<Request*> records(kBatch);
+  for (auto _ : state) {
+    for (auto& record : records) {
+      record = allocator.new_object<Request>(std::int64_t{1}, "/quote", 0.5);
+    }
+    benchmark::DoNotOptimize(records.data());
+    for (auto* record : records) { allocator.delete_object(record); }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kBatch));
+}
+
+void BM_RecordsNamedTuplePool(benchmark::State& state) {
+  using Pool = mguid::NamedTuplePool<Request>;
+  std::vector<Pool::Handle> records(kBatch);
+  for (auto _ : state) {
+    for (auto& record : records) { record = Pool::make(std::int64_t{1}, "/quote", 0.5); }
+    benchmark::DoNotOptimize(records.data());
+    for (auto& record : records) { record.reset(); }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kBatch));
+}
+
+void BM_RecordsNamedTuplePoolKeepConstructed(benchmark::State& state) {
+  using Pool = mguid::NamedTuplePool<Request, true>;
+  std::vector<Pool::Handle> records(kBatch);
+  for (auto _ : state) {
+    for (auto& record : records) {
+      record = Pool::acquire();
+      record->set<"id">(std::int64_t{1});
+      record->get<"route">().assign("/quote");
+      record->set<"deadline">(0.5);
+    }
+    benchmark::DoNotOptimize(records.data());
+    for (auto& record : records) { record.reset(); }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kBatch));
+}
+}  // namespace
+
+BENCHMARK(BM_RecordsStdAllocator)->Threads(1)->Threads(4);
+BENCHMARK(BM_RecordsSynchronizedPool)->Threads(1)->Threads(4);
+BENCHMARK(BM_RecordsNamedTuplePool)->Threads(1)->Threads(4);
+BENCHMARK(BM_RecordsNamedTuplePoolKeepConstructed)->Threads(1)->Threads(4);
@@ -0,0 +1,85 @@
+#include "NamedTupleTranspose.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace {
+using Quote = mguid::NamedTuple<mguid::NamedType<"ts", std::int64_t>, mguid::NamedType<"id", int>,
+                                mguid::NamedType<"bid", double>, mguid::NamedType<"ask", double>,
+                                mguid::NamedType<"size", float>>;
+using QuoteColumns = mguid::ColumnsOf<Quote>::type;
+
+std::vector<Quote> make_quotes(std::size_t count) {
+  std::mt19937_64 engine{42};
+  std::uniform_int_distribution<std::int64_t> ts{0, 1'000'000};
+  std::uniform_int_distribution<int> id{0, 500};
+  std::uniform_real_distribution<double> price{0.0, 100.0};
+  std::vector<Quote> result;
+  result.reserve(count);
+  for (std::size_t index{0}; index < count; ++index) {
+    result.emplace_back(ts(engine), id(engine), price(engine), price(engine),
+                        static_cast<float>(price(engine)));
+  }
+  return result;
+}
+
+void BM_ToColumnsElementWise(benchmark::State& state) {
+  const auto quotes = make_quotes(static_cast<std::size_t>(state.range(0)));
+  QuoteColumns columns;
+  columns.reserve(quotes.size());
+  for (auto _ : state) {
+    columns.clear();
+    for (const auto& quote : quotes) { columns.push_back(quote); }
+    benchmark::DoNotOptimize(columns.column<"ask">().data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          static_cast<std::int64_t>(sizeof(Quote)));
+}
+
+void BM_ToColumnsTranspose(benchmark::State& state) {
+  const auto quotes = make_quotes(static_cast<std::size_t>(state.range(0)));
+  QuoteColumns columns;
+  columns.reserve(quotes.size());
+  for (auto _ : state) {
+    columns.clear();
+    mguid::to_columns(std::span<const Quote>{quotes}, columns);
+    benchmark::DoNotOptimize(columns.column<"ask">().data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          static_cast<std::int64_t>(sizeof(Quote)));
+}
+
+void BM_FromColumnsElementWise(benchmark::State& state) {
+  const auto columns = mguid::to_columns(make_quotes(static_cast<std::size_t>(state.range(0))));
+  std::vector<Quote> quotes(columns.size());
+  for (auto _ : state) {
+    for (std::size_t index{0}; index < columns.size(); ++index) {
+      quotes[index] = Quote{columns.column<"ts">()[index], columns.column<"id">()[index],
+                            columns.column<"bid">()[index], columns.column<"ask">()[index],
+                            columns.column<"size">()[index]};
+    }
+    benchmark::DoNotOptimize(quotes.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          static_cast<std::int64_t>(sizeof(Quote)));
+}
+
+void BM_FromColumnsTranspose(benchmark::State& state) {
+  const auto columns = mguid::to_columns(make_quotes(static_cast<std::size_t>(state.range(0))));
+  std::vector<Quote> quotes(columns.size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mguid::from_columns(columns, std::span{quotes}));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          static_cast<std::int64_t>(sizeof(Quote)));
+}
+}  // namespace
+
+BENCHMARK(BM_ToColumnsElementWise)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_ToColumnsTranspose)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_FromColumnsElementWise)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_FromColumnsTranspose)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,92 @@
+"""Measure the compile time and peak compiler memory of NamedTuple instantiations.
+
+Generates a translation unit holding a NamedTuple with N fields, looks every field up by tag and
+compares two tuples, then compiles it and records wall time and maximum resident set size of the
+compiler process.
+
+Usage:
+    python3 compile_time_benchmark.py [--compiler g++] [--include-dir ../../include] [--sizes 50 200 500]
+                                      [--csv results.csv]
+"""
+
+import argparse
+import csv
+import os
+import subprocess
+import sys
+import time
+from tempfile import TemporaryDirectory
+
+
+def generate_source(size):
+    fields = ",\n    ".join(f'mguid::NamedType<"field_{i}", int>' for i in range(size))
+    gets = "\n".join(f'  sum += nt.get<"field_{i}">();' for i in range(size))
+    return f"""#include "NamedTuple.hpp"
+
+using Wide = mguid::NamedTuple<
+    {fields}>;
+
+int accumulate(Wide& nt, const Wide& other) {{
+  int sum{{0}};
+{gets}
+  return sum + static_cast<int>(nt == other);
+}}
+"""
+
+
+def compile_and_measure(compiler, include_dir, source_path, object_path, extra_args):
+    command = [compiler, "-std=c++20", f"-I{include_dir}", *extra_args, "-c", source_path, "-o",
+               object_path]
+    start = time.perf_counter()
+    process = subprocess.Popen(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    _, status, usage = os.wait4(process.pid, 0)
+    elapsed = time.perf_counter() - start
+    output = process.stdout.read().decode("utf-8")
+    process.stdout.close()
+    if os.waitstatus_to_exitcode(status) != 0:
+        raise RuntimeError(f"compilation failed:\n{output}")
+    # ru_maxrss is reported in kilobytes on Linux
+    return elapsed, usage.ru_maxrss / 1024.0
+
+
+def main():
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default="g++")
+    parser.add_argument("--include-dir", default=os.path.join(script_dir, "..", "..", "include"))
+    parser.add_argument("--sizes", type=int, nargs="+", default=[50, 200, 500])
+    parser.add_argument("--repetitions", type=int, default=3)
+    parser.add_argument("--csv", help="also write the results to this CSV file")
+    parser.add_argument("compiler_args", nargs="*", help="extra arguments passed to the compiler")
+    args = parser.parse_args()
+
+    extra_args = [f"-ftemplate-depth={max(args.sizes) * 4 + 1024}", *args.compiler_args]
+
+    rows = []
+    print(f"{'fields':>8} {'seconds':>10} {'peak MiB':>10}")
+    with TemporaryDirectory() as temp_dir:
+        for size in args.sizes:
+            source_path = os.path.join(temp_dir, f"wide_{size}.cpp")
+            object_path = os.path.join(temp_dir, f"wide_{size}.o")
+            with open(source_path, "w") as source:
+                source.write(generate_source(size))
+
+            results = [compile_and_measure(args.compiler, args.include_dir, source_path,
+                                           object_path, extra_args)
+                       for _ in range(args.repetitions)]
+            best_time = min(elapsed for elapsed, _ in results)
+            peak_memory = max(memory for _, memory in results)
+            rows.append((size, best_time, peak_memory))
+            print(f"{size:>8} {best_time:>10.2f} {peak_memory:>10.1f}")
+            sys.stdout.flush()
+
+    if args.csv:
+        with open(args.csv, "w", newline="") as output:
+            writer = csv.writer(output)
+            writer.writerow(["fields", "seconds", "peak_mib"])
+            writer.writerows(rows)
+
+
+if __name__ == '__main__':
+    main()
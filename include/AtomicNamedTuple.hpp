@@ -0,0 +1,268 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+
+#ifndef MGUID_ATOMICNAMEDTUPLE_H
+#define MGUID_ATOMICNAMEDTUPLE_H
+
+#include "NamedTuple.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace mguid {
+
+/**
+ * @brief Storage of a single element of a BasicAtomicNamedTuple
+ * @tparam Type type of the element
+ * @tparam Padded true to give the element a cache line of its own
+ */
+template <typename Type, bool Padded>
+struct AtomicSlot {
+  constexpr AtomicSlot() noexcept = default;
+  constexpr explicit AtomicSlot(Type initial) noexcept : value{initial} {}
+
+  std::atomic<Type> value{};
+};
+
+/**
+ * @brief Storage of a single element of a BasicAtomicNamedTuple aligned to a cache line
+ * @tparam Type type of the element
+ */
+template <typename Type>
+struct alignas(kCacheLineSize) AtomicSlot<Type, true> {
+  constexpr AtomicSlot() noexcept = default;
+  constexpr explicit AtomicSlot(Type initial) noexcept : value{initial} {}
+
+  std::atomic<Type> value{};
+};
+
+/**
+ * @brief A NamedTuple like object whose elements are each stored as a std::atomic, for shared
+ * state such as counters that is updated by many threads without a lock
+ *
+ * Every element is independent, snapshot loads the elements one by one and does not observe a
+ * consistent state across elements that are updated concurrently.
+ *
+ * @tparam Padded true to place every element in a cache line of its own to avoid false sharing
+ * @tparam NamedTypes pack of NamedType with unique names and trivially copyable types
+ */
+template <bool Padded, typename... NamedTypes>
+  requires(all_unique_v<NamedTypes...> &&
+           (std::is_trivially_copyable_v<typename ExtractType<NamedTypes>::type> && ...))
+class BasicAtomicNamedTuple {
+  template <StringLiteral Tag>
+  using ElementType = typename ExtractType<
+      std::tuple_element_t<key_index_v<Tag, NamedTypes...>, std::tuple<NamedTypes...>>>::type;
+
+public:
+  using Snapshot = NamedTuple<NamedTypes...>;
+
+  /**
+   * @brief Whether every element is always lock free
+   */
+  static constexpr bool is_always_lock_free{
+      (std::atomic<typename ExtractType<NamedTypes>::type>::is_always_lock_free && ...)};
+
+  /**
+   * @brief Construct this BasicAtomicNamedTuple value initializing all elements
+   */
+  constexpr BasicAtomicNamedTuple() noexcept = default;
+
+  /**
+   * @brief Construct this BasicAtomicNamedTuple initializing the elements from a NamedTuple
+   * @param initial NamedTuple holding the initial value of every element
+   */
+  constexpr explicit BasicAtomicNamedTuple(const Snapshot& initial) noexcept
+      : BasicAtomicNamedTuple(initial, std::index_sequence_for<NamedTypes...>{}) {}
+
+  BasicAtomicNamedTuple(const BasicAtomicNamedTuple&) = delete;
+  BasicAtomicNamedTuple& operator=(const BasicAtomicNamedTuple&) = delete;
+
+  /**
+   * @brief Get the number of elements this BasicAtomicNamedTuple holds
+   * @return the number of elements this BasicAtomicNamedTuple holds
+   */
+  [[nodiscard]] static constexpr std::size_t size() noexcept { return sizeof...(NamedTypes); }
+
+  /**
+   * @brief Access the atomic holding the element whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @return a reference to the atomic holding the element
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] constexpr std::atomic<ElementType<Tag>>& atomic() noexcept {
+    return std::get<key_index_v<Tag, NamedTypes...>>(m_slots).value;
+  }
+
+  /**
+   * @brief Access the atomic holding the element whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @return a const reference to the atomic holding the element
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] constexpr const std::atomic<ElementType<Tag>>& atomic() const noexcept {
+    return std::get<key_index_v<Tag, NamedTypes...>>(m_slots).value;
+  }
+
+  /**
+   * @brief Atomically load the element whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @param order memory order of the load
+   * @return the value of the element
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] ElementType<Tag> load(
+      std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    return atomic<Tag>().load(order);
+  }
+
+  /**
+   * @brief Atomically replace the element whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @param value value to store
+   * @param order memory order of the store
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  void store(ElementType<Tag> value,
+             std::memory_order order = std::memory_order_seq_cst) noexcept {
+    atomic<Tag>().store(value, order);
+  }
+
+  /**
+   * @brief Atomically replace the element whose name is Tag and return its previous value
+   * @tparam Tag a StringLiteral to search for
+   * @param value value to store
+   * @param order memory order of the exchange
+   * @return the value of the element before the exchange
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  ElementType<Tag> exchange(ElementType<Tag> value,
+                            std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return atomic<Tag>().exchange(value, order);
+  }
+
+  /**
+   * @brief Atomically replace the element whose name is Tag if it equals expected
+   * @tparam Tag a StringLiteral to search for
+   * @param expected value the element is expected to hold, updated to the actual value on failure
+   * @param desired value to store if the element holds expected
+   * @param order memory order of the operation
+   * @return true if the element was replaced; otherwise false
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  bool compare_exchange(ElementType<Tag>& expected, ElementType<Tag> desired,
+                        std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return atomic<Tag>().compare_exchange_strong(expected, desired, order);
+  }
+
+  /**
+   * @brief Atomically add to the element whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @param value value to add
+   * @param order memory order of the operation
+   * @return the value of the element before the addition
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...> &&
+             requires(std::atomic<ElementType<Tag>>& element, ElementType<Tag> value) {
+               element.fetch_add(value);
+             })
+  ElementType<Tag> fetch_add(ElementType<Tag> value,
+                             std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return atomic<Tag>().fetch_add(value, order);
+  }
+
+  /**
+   * @brief Atomically subtract from the element whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @param value value to subtract
+   * @param order memory order of the operation
+   * @return the value of the element before the subtraction
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...> &&
+             requires(std::atomic<ElementType<Tag>>& element, ElementType<Tag> value) {
+               element.fetch_sub(value);
+             })
+  ElementType<Tag> fetch_sub(ElementType<Tag> value,
+                             std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return atomic<Tag>().fetch_sub(value, order);
+  }
+
+  /**
+   * @brief Load every element into a NamedTuple, each element is loaded atomically but the
+   * elements are not loaded at the same instant
+   * @param order memory order of every load
+   * @return a NamedTuple holding the loaded values in declared order
+   */
+  [[nodiscard]] Snapshot snapshot(
+      std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    return [this, order]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+      return Snapshot{std::get<Indices>(m_slots).value.load(order)...};
+    }(std::index_sequence_for<NamedTypes...>{});
+  }
+
+private:
+  template <std::size_t... Indices>
+  constexpr BasicAtomicNamedTuple(const Snapshot& initial, std::index_sequence<Indices...>) noexcept
+      : m_slots{initial.template get<Indices>()...} {}
+
+  std::tuple<AtomicSlot<typename ExtractType<NamedTypes>::type, Padded>...> m_slots{};
+};
+
+/**
+ * @brief A BasicAtomicNamedTuple whose elements are stored next to each other
+ * @tparam NamedTypes pack of NamedType with unique names and trivially copyable types
+ */
+template <typename... NamedTypes>
+using AtomicNamedTuple = BasicAtomicNamedTuple<false, NamedTypes...>;
+
+/**
+ * @brief A BasicAtomicNamedTuple whose elements are each placed in a cache line of their own, so
+ * threads updating different elements do not contend on the same cache line
+ * @tparam NamedTypes pack of NamedType with unique names and trivially copyable types
+ */
+template <typename... NamedTypes>
+using PaddedAtomicNamedTuple = BasicAtomicNamedTuple<true, NamedTypes...>;
+
+}  // namespace mguid
+
+#endif  // MGUID_ATOMICNAMEDTUPLE_H
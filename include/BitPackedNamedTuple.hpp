@@ -0,0 +1,458 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+
+#ifndef MGUID_BITPACKEDNAMEDTUPLE_H
+#define MGUID_BITPACKEDNAMEDTUPLE_H
+
+#include "PackedNamedTuple.hpp"
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace mguid {
+
+/**
+ * @brief Annotation for a NamedType whose value is stored in Width bits of a shared word
+ *
+ * NamedType<"side", Bits<std::uint8_t, 1>> declares a BitPackedNamedTuple element of type
+ * std::uint8_t that occupies a single bit.
+ *
+ * @tparam Type integral, bool or enumeration type of the element
+ * @tparam Width number of bits used to store the element
+ */
+template <typename Type, std::size_t Width>
+  requires((std::is_integral_v<Type> || std::is_enum_v<Type>) && Width > 0 &&
+           Width <= sizeof(Type) * 8)
+struct Bits {
+  using value_type = Type;
+  static constexpr std::size_t width{Width};
+};
+
+/**
+ * @brief Determine whether a type is a Bits annotation
+ * @tparam Type type to check
+ */
+template <typename Type>
+struct IsBits : std::false_type {};
+
+/**
+ * @brief Determine whether a type is a Bits annotation
+ * @tparam Type type of the element
+ * @tparam Width number of bits used to store the element
+ */
+template <typename Type, std::size_t Width>
+struct IsBits<Bits<Type, Width>> : std::true_type {};
+
+/**
+ * @brief Helper variable template for IsBits
+ * @tparam Type type to check
+ */
+template <typename Type>
+inline constexpr bool is_bits_v{IsBits<Type>::value};
+
+/**
+ * @brief Get the type of an element with any Bits annotation removed
+ * @tparam Type type of the element, possibly annotated
+ */
+template <typename Type>
+struct UnannotatedType {
+  using type = Type;
+};
+
+/**
+ * @brief Get the type of an element with any Bits annotation removed
+ * @tparam Type type of the element
+ * @tparam Width number of bits used to store the element
+ */
+template <typename Type, std::size_t Width>
+struct UnannotatedType<Bits<Type, Width>> {
+  using type = Type;
+};
+
+/**
+ * @brief Get the number of bits an element is stored in, 0 for elements without a Bits annotation
+ * @tparam Type type of the element, possibly annotated
+ */
+template <typename Type>
+inline constexpr std::size_t bit_width_v{0};
+
+/**
+ * @brief Get the number of bits an element is stored in, 0 for elements without a Bits annotation
+ * @tparam Type type of the element
+ * @tparam Width number of bits used to store the element
+ */
+template <typename Type, std::size_t Width>
+inline constexpr std::size_t bit_width_v<Bits<Type, Width>>{Width};
+
+/**
+ * @brief Collect the NamedTypes without a Bits annotation into a PackedNamedTuple
+ * @tparam Plain PackedNamedTuple collected so far
+ * @tparam NamedTypes NamedTypes left to inspect
+ */
+template <typename Plain, typename... NamedTypes>
+struct PlainFields {
+  using type = Plain;
+};
+
+/**
+ * @brief Collect the NamedTypes without a Bits annotation into a PackedNamedTuple
+ * @tparam Collected NamedTypes collected so far
+ * @tparam First NamedType to inspect
+ * @tparam Rest NamedTypes left to inspect
+ */
+template <typename... Collected, typename First, typename... Rest>
+struct PlainFields<PackedNamedTuple<Collected...>, First, Rest...>
+    : PlainFields<std::conditional_t<is_bits_v<typename ExtractType<First>::type>,
+                                     PackedNamedTuple<Collected...>,
+                                     PackedNamedTuple<Collected..., First>>,
+                  Rest...> {};
+
+/**
+ * @brief Mask covering the low Width bits of a 64-bit word
+ * @tparam Width number of bits to cover
+ */
+template <std::size_t Width>
+inline constexpr std::uint64_t kBitMask{Width >= 64 ? ~std::uint64_t{0}
+                                                    : (std::uint64_t{1} << Width) - 1};
+
+/**
+ * @brief Read a value stored in Width bits of word starting at bit Shift
+ *
+ * Signed values, and enumerations with a signed underlying type, are sign extended.
+ *
+ * @tparam Type type of the value
+ * @tparam Shift index of the lowest bit of the value
+ * @tparam Width number of bits the value is stored in
+ * @tparam Word type of the word holding the value
+ * @param word word holding the value
+ * @return the stored value
+ */
+template <typename Type, std::size_t Shift, std::size_t Width, typename Word>
+[[nodiscard]] constexpr Type read_bits(Word word) noexcept {
+  using Integer = typename std::conditional_t<std::is_enum_v<Type>, std::underlying_type<Type>,
+                                              std::type_identity<Type>>::type;
+  std::uint64_t raw{(static_cast<std::uint64_t>(word) >> Shift) & kBitMask<Width>};
+  if constexpr (std::is_signed_v<Integer> && Width < 64) {
+    if ((raw >> (Width - 1)) & 1U) { raw |= ~kBitMask<Width>; }
+  }
+  return static_cast<Type>(static_cast<Integer>(raw));
+}
+
+/**
+ * @brief Overwrite the Width bits of word starting at bit Shift with value
+ *
+ * Only the low Width bits of value are stored.
+ *
+ * @tparam Type type of the value
+ * @tparam Shift index of the lowest bit of the value
+ * @tparam Width number of bits the value is stored in
+ * @tparam Word type of the word holding the value
+ * @param word word holding the value
+ * @param value value to store
+ */
+template <typename Type, std::size_t Shift, std::size_t Width, typename Word>
+constexpr void write_bits(Word& word, Type value) noexcept {
+  using Integer = typename std::conditional_t<std::is_enum_v<Type>, std::underlying_type<Type>,
+                                              std::type_identity<Type>>::type;
+  const std::uint64_t raw{static_cast<std::uint64_t>(static_cast<Integer>(value)) &
+                          kBitMask<Width>};
+  word = static_cast<Word>((static_cast<std::uint64_t>(word) & ~(kBitMask<Width> << Shift)) |
+                           (raw << Shift));
+}
+
+/**
+ * @brief A reference to an element stored in the bits of a shared word
+ * @tparam Type type of the element
+ * @tparam Shift index of the lowest bit of the element
+ * @tparam Width number of bits the element is stored in
+ * @tparam Word type of the word holding the element
+ */
+template <typename Type, std::size_t Shift, std::size_t Width, typename Word>
+class BitFieldRef {
+public:
+  using value_type = Type;
+
+  /**
+   * @brief Construct a reference to the element stored in word
+   * @param word word holding the element
+   */
+  constexpr explicit BitFieldRef(Word& word) noexcept : m_word{&word} {}
+
+  constexpr BitFieldRef(const BitFieldRef&) noexcept = default;
+
+  /**
+   * @brief Read the referenced element
+   * @return the value of the referenced element
+   */
+  [[nodiscard]] constexpr operator Type() const noexcept {  // NOLINT(google-explicit-constructor)
+    return read_bits<Type, Shift, Width>(*m_word);
+  }
+
+  /**
+   * @brief Overwrite the referenced element, keeping only the low Width bits of value
+   * @param value value to store
+   * @return a reference to this
+   */
+  constexpr BitFieldRef& operator=(Type value) noexcept {
+    write_bits<Type, Shift, Width>(*m_word, value);
+    return *this;
+  }
+
+  /**
+   * @brief Overwrite the referenced element with the value referenced by other
+   * @param other reference to the element to copy
+   * @return a reference to this
+   */
+  constexpr BitFieldRef& operator=(const BitFieldRef& other) noexcept {
+    return *this = static_cast<Type>(other);
+  }
+
+private:
+  Word* m_word;
+};
+
+/**
+ * @brief A NamedTuple that packs the elements annotated with Bits into shared words
+ *
+ * Annotated elements are packed in declared order into the smallest unsigned word that holds all of
+ * them, or into 64-bit words when they need more than 64 bits, without straddling words. The
+ * remaining elements are stored in a PackedNamedTuple. Mutable access to an annotated element
+ * returns a BitFieldRef, const access returns its value. Storing a value that does not fit in the
+ * width of an element keeps only its low bits.
+ *
+ * @tparam NamedTypes pack of NamedType types with unique names
+ */
+template <typename... NamedTypes>
+  requires(all_unique_v<NamedTypes...>)
+class BitPackedNamedTuple {
+  static constexpr std::array<std::size_t, sizeof...(NamedTypes)> kWidths{
+      bit_width_v<typename ExtractType<NamedTypes>::type>...};
+
+  static constexpr std::size_t kPackedBits{(std::size_t{0} + ... +
+                                            bit_width_v<typename ExtractType<NamedTypes>::type>)};
+
+public:
+  using Word = BitmapWord<kPackedBits>;
+  using Plain = typename PlainFields<PackedNamedTuple<>, NamedTypes...>::type;
+  using Unpacked = NamedTuple<typename RebindType<
+      NamedTypes, typename UnannotatedType<typename ExtractType<NamedTypes>::type>::type>::type...>;
+
+  static constexpr std::size_t kWordBits{sizeof(Word) * 8};
+
+private:
+  struct BitField {
+    std::size_t word{0};
+    std::size_t shift{0};
+  };
+
+  struct BitLayout {
+    std::array<BitField, sizeof...(NamedTypes)> fields{};
+    std::size_t word_count{0};
+  };
+
+  static constexpr BitLayout kLayout = [] {
+    BitLayout layout{};
+    std::size_t used{kWordBits};
+    for (std::size_t index{0}; index < kWidths.size(); ++index) {
+      if (kWidths[index] == 0) { continue; }
+      if (used + kWidths[index] > kWordBits) {
+        ++layout.word_count;
+        used = 0;
+      }
+      layout.fields[index] = BitField{layout.word_count - 1, used};
+      used += kWidths[index];
+    }
+    return layout;
+  }();
+
+  template <std::size_t Index>
+  using Ref = BitFieldRef<typename UnannotatedType<typename ExtractType<
+                              std::tuple_element_t<Index, std::tuple<NamedTypes...>>>::type>::type,
+                          kLayout.fields[Index].shift, kWidths[Index], Word>;
+
+public:
+  using Words = std::array<Word, kLayout.word_count>;
+
+  /**
+   * @brief Construct this BitPackedNamedTuple value initializing all elements
+   */
+  constexpr BitPackedNamedTuple() = default;
+
+  /**
+   * @brief Construct this BitPackedNamedTuple initializing all elements
+   * @tparam InitTypes types of initializer values
+   * @param init_values values to initialize each tuple element, in declared order
+   */
+  template <typename... InitTypes>
+    requires(sizeof...(InitTypes) == sizeof...(NamedTypes) && sizeof...(InitTypes) > 0 &&
+             !(sizeof...(InitTypes) == 1 &&
+               (std::is_same_v<std::remove_cvref_t<InitTypes>, BitPackedNamedTuple> || ...)))
+  constexpr explicit BitPackedNamedTuple(InitTypes&&... init_values)
+      : BitPackedNamedTuple(Unpacked{std::forward<InitTypes>(init_values)...}) {}
+
+  /**
+   * @brief Construct this BitPackedNamedTuple by copying the elements of a NamedTuple
+   * @param other NamedTuple with the unannotated NamedTypes to copy from
+   */
+  constexpr explicit BitPackedNamedTuple(const Unpacked& other) {
+    (set<NamedTypes{}.tag()>(other.template get<NamedTypes{}.tag()>()), ...);
+  }
+
+  /**
+   * @brief Get the number of elements this BitPackedNamedTuple holds
+   * @return the number of elements this BitPackedNamedTuple holds
+   */
+  [[nodiscard]] constexpr std::size_t size() const { return sizeof...(NamedTypes); }
+
+  /**
+   * @brief Check whether the element whose name is Tag is stored in the bits of a shared word
+   * @tparam Tag a StringLiteral to search for
+   * @return true if the element has a Bits annotation; otherwise false
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] static constexpr bool is_bit_field() noexcept {
+    return kWidths[key_index_v<Tag, NamedTypes...>] != 0;
+  }
+
+  /**
+   * @brief Extracts the element of the BitPackedNamedTuple whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @return a BitFieldRef for an annotated element; otherwise a reference to the element
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] constexpr decltype(auto) get() & noexcept {
+    constexpr auto kIndex = key_index_v<Tag, NamedTypes...>;
+    if constexpr (kWidths[kIndex] != 0) {
+      return Ref<kIndex>{m_words[kLayout.fields[kIndex].word]};
+    } else {
+      return m_plain.template get<Tag>();
+    }
+  }
+
+  /**
+   * @brief Extracts the element of the BitPackedNamedTuple whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @return the value of an annotated element; otherwise a const reference to the element
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] constexpr decltype(auto) get() const& noexcept {
+    constexpr auto kIndex = key_index_v<Tag, NamedTypes...>;
+    if constexpr (kWidths[kIndex] != 0) {
+      return read_bits<typename Ref<kIndex>::value_type, kLayout.fields[kIndex].shift,
+                       kWidths[kIndex]>(m_words[kLayout.fields[kIndex].word]);
+    } else {
+      return m_plain.template get<Tag>();
+    }
+  }
+
+  /**
+   * @brief Set the element of the BitPackedNamedTuple with the name Tag to value
+   *
+   * For an annotated element this is a masked write that keeps only the low bits of value.
+   *
+   * @tparam Tag StringLiteral element name
+   * @tparam Value type of value, convertible to the type of the element associated with Tag
+   * @param value value to set
+   */
+  template <StringLiteral Tag, typename Value>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  constexpr void set(Value&& value) {
+    constexpr auto kIndex = key_index_v<Tag, NamedTypes...>;
+    if constexpr (kWidths[kIndex] != 0) {
+      get<Tag>() = static_cast<typename Ref<kIndex>::value_type>(std::forward<Value>(value));
+    } else {
+      m_plain.template set<Tag>(std::forward<Value>(value));
+    }
+  }
+
+  /**
+   * @brief Get the words holding the annotated elements
+   * @return a const reference to the words
+   */
+  [[nodiscard]] constexpr const Words& words() const noexcept { return m_words; }
+
+  /**
+   * @brief Copy the elements of this BitPackedNamedTuple into a NamedTuple in declared order
+   * @return a NamedTuple with the unannotated NamedTypes
+   */
+  [[nodiscard]] constexpr Unpacked to_tuple() const {
+    return Unpacked{get<NamedTypes{}.tag()>()...};
+  }
+
+  /**
+   * @brief Compare against another BitPackedNamedTuple
+   *
+   * Unused bits are always zero, so the annotated elements are compared a word at a time.
+   *
+   * @param other another BitPackedNamedTuple to compare against
+   * @return Returns true if all pairs of corresponding elements are equal; otherwise false
+   */
+  [[nodiscard]] constexpr bool operator==(const BitPackedNamedTuple& other) const {
+    return m_words == other.m_words && m_plain == other.m_plain;
+  }
+
+  /**
+   * @brief Spaceship compare against another BitPackedNamedTuple, in declared order
+   * @param other another BitPackedNamedTuple to compare against
+   * @return The relation between the first pair of non-equivalent elements if there is any,
+   * std::strong_ordering::equal otherwise.
+   */
+  [[nodiscard]] constexpr auto operator<=>(const BitPackedNamedTuple& other) const {
+    std::common_comparison_category_t<SynthThreeWayResultT<
+        typename UnannotatedType<typename ExtractType<NamedTypes>::type>::type,
+        typename UnannotatedType<typename ExtractType<NamedTypes>::type>::type>...>
+        result = std::strong_ordering::equivalent;
+
+    ([this, &other, &result]<StringLiteral Tag>() {
+      result = SynthThreeWay(this->get<Tag>(), other.template get<Tag>());
+      return result != 0;
+    }.template operator()<NamedTypes{}.tag()>() ||
+     ...);
+
+    return result;
+  }
+
+private:
+  Plain m_plain{};
+  Words m_words{};
+};
+}  // namespace mguid
+
+#endif  // MGUID_BITPACKEDNAMEDTUPLE_H
@@ -33,14 +33,39 @@
 #define MGUID_NAMEDTUPLE_H
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cstdint>
+#include <cstring>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
 
+#if defined(NAMED_TUPLE_ACCESS_COUNTERS)
+#include <atomic>
+#endif
+
 namespace mguid {
 
+/**
+ * @brief Assumed size of a cache line, used to align and pad storage in the containers built on
+ * top of NamedTuple
+ */
+inline constexpr std::size_t kCacheLineSize{64};
+
+/**
+ * @brief The smallest unsigned integer type holding Bits bits, or std::uint64_t for larger bitmaps
+ * @tparam Bits number of bits to hold
+ */
+template <std::size_t Bits>
+using BitmapWord = std::conditional_t<
+    (Bits <= 8), std::uint8_t,
+    std::conditional_t<(Bits <= 16), std::uint16_t,
+                       std::conditional_t<(Bits <= 32), std::uint32_t, std::uint64_t>>>;
+
 /**
  * @brief Compile time string literal container
  * @tparam NSize size of string literal
@@ -145,29 +170,201 @@ struct NamedType {
    * @return the tag passed to this NamedType
    */
   constexpr StringLiteral<Tag.size> tag() const { return Tag; }
+
+  /**
+   * @brief Get the tag passed to this NamedType as a string_view
+   * @return a string_view over the tag, not including the null-terminator
+   */
+  static constexpr std::string_view name() { return std::string_view{Tag.value, Tag.size - 1}; }
+};
+
+/**
+ * @brief A deferred construction of a value of type Type from a list of constructor arguments, so
+ * that a tuple element can be constructed in place instead of being moved into the tuple
+ * @tparam Type type of value to construct
+ * @tparam Args types of constructor arguments
+ */
+template <typename Type, typename... Args>
+struct InPlaceConstruct {
+  std::tuple<Args&&...> args;
+
+  /**
+   * @brief Construct the value from the stored arguments
+   * @return the constructed value
+   */
+  constexpr Type construct() && { return std::make_from_tuple<Type>(std::move(args)); }
+
+  // NOLINTBEGIN(google-explicit-constructor)
+  /**
+   * @brief Construct the value from the stored arguments
+   * @return the constructed value
+   */
+  constexpr explicit(false) operator Type() && { return std::move(*this).construct(); }
+  // NOLINTEND(google-explicit-constructor)
+};
+
+/**
+ * @brief Whether a type is an InPlaceConstruct
+ * @tparam Type type to check
+ */
+template <typename Type>
+inline constexpr bool is_in_place_construct_v{false};
+
+/**
+ * @brief Whether a type is an InPlaceConstruct
+ * @tparam Type type of value to construct
+ * @tparam Args types of constructor arguments
+ */
+template <typename Type, typename... Args>
+inline constexpr bool is_in_place_construct_v<InPlaceConstruct<Type, Args...>>{true};
+
+/**
+ * @brief An argument no type is meant to be constructed from
+ */
+struct UnrelatedArgument {};
+
+/**
+ * @brief Whether a type has a constructor accepting arguments of any type, like the converting
+ * constructor of std::any, which would capture an InPlaceConstruct instead of using its conversion
+ * @tparam Type type to check
+ */
+template <typename Type>
+inline constexpr bool constructible_from_any_v{std::is_constructible_v<Type, UnrelatedArgument>};
+
+/**
+ * @brief Base template of helper template to find the element type a value helper initializes
+ * @tparam ValueType type of value held by a NamedTypeValueHelper
+ */
+template <typename ValueType>
+struct HelperElementType {
+  using type = std::unwrap_ref_decay_t<ValueType>;
+};
+
+/**
+ * @brief Partially specialized helper template for values constructed in place
+ * @tparam Type type of value to construct
+ * @tparam Args types of constructor arguments
+ */
+template <typename Type, typename... Args>
+struct HelperElementType<InPlaceConstruct<Type, Args...>> {
+  using type = Type;
 };
 
 /**
  * @brief A type that associates a NamedType with a value
+ *
+ * When ValueType is an lvalue reference the helper only refers to the value, so it must not
+ * outlive the object it refers to; otherwise the helper holds its own value.
+ *
  * @tparam Tag StringLiteral element name
  * @tparam ValueType type of value this will hold
  */
 template <StringLiteral Tag, typename ValueType>
 struct NamedTypeValueHelper {
-  using DecayT = NamedType<Tag, std::unwrap_ref_decay_t<ValueType>>;
+  using DecayT = NamedType<Tag, typename HelperElementType<std::remove_cvref_t<ValueType>>::type>;
+
+  /**
+   * @brief Get the tag associated with the value as a string_view
+   * @return a string_view over the tag, not including the null-terminator
+   */
+  static constexpr std::string_view name() { return DecayT::name(); }
+
   ValueType value{};
 };
 
 /**
- * @brief A helper to associate a value with a named type for use in make_tuple
+ * @brief Whether a type is a NamedTypeValueHelper
+ * @tparam Type type to check
+ */
+template <typename Type>
+inline constexpr bool is_value_helper_v{false};
+
+/**
+ * @brief Whether a type is a NamedTypeValueHelper
+ * @tparam Tag StringLiteral element name
+ * @tparam ValueType type of value held by the helper
+ */
+template <StringLiteral Tag, typename ValueType>
+inline constexpr bool is_value_helper_v<NamedTypeValueHelper<Tag, ValueType>>{true};
+
+/**
+ * @brief Whether the first type of a pack is std::allocator_arg_t
+ * @tparam Types pack of types
+ */
+template <typename... Types>
+inline constexpr bool starts_with_allocator_arg_v{false};
+
+/**
+ * @brief Whether the first type of a pack is std::allocator_arg_t
+ * @tparam First first type of the pack
+ * @tparam Rest remaining types of the pack
+ */
+template <typename First, typename... Rest>
+inline constexpr bool starts_with_allocator_arg_v<First, Rest...>{
+    std::is_same_v<std::remove_cvref_t<First>, std::allocator_arg_t>};
+
+/**
+ * @brief Forward the value held by a NamedTypeValueHelper with its original value category
+ *
+ * A value constructed in place for an element type constructible from any argument is constructed
+ * here, since the converting constructor of the element would capture the InPlaceConstruct.
+ *
+ * @tparam Helper type of NamedTypeValueHelper
+ * @param helper helper whose value to forward
+ * @return a reference to the value of helper, or the value constructed in place
+ */
+template <typename Helper>
+[[nodiscard]] constexpr decltype(auto) forward_value(Helper&& helper) {
+  using ValueType = decltype(std::remove_cvref_t<Helper>::value);
+  if constexpr (std::is_reference_v<ValueType>) {
+    return std::forward<ValueType>(helper.value);
+  } else if constexpr (is_in_place_construct_v<ValueType> &&
+                       constructible_from_any_v<typename HelperElementType<ValueType>::type>) {
+    return std::move(helper.value).construct();
+  } else {
+    return (std::forward<Helper>(helper).value);
+  }
+}
+
+/**
+ * @brief Helper alias for what a NamedTypeValueHelper created from a forwarded value holds, a
+ * reference to an lvalue or the decayed value of an rvalue, so a helper stored in a variable never
+ * refers to a destroyed temporary
+ * @tparam ValueType deduced type of a forwarding reference
+ */
+template <typename ValueType>
+using HelperValueT = std::conditional_t<std::is_lvalue_reference_v<ValueType>, ValueType,
+                                        std::decay_t<ValueType>>;
+
+/**
+ * @brief A helper to associate a value with a named type for use in make_tuple, an lvalue is
+ * referred to and not copied until it is stored in the tuple, an rvalue is moved into the helper
  * @tparam Tag StringLiteral element name
  * @tparam ValueType type of value
  * @param value value to associate with NamedType
- * @return a NamedTypeValueHelper object with the given value and Tag
+ * @return a NamedTypeValueHelper object holding the given value with the given Tag
  */
 template <StringLiteral Tag, typename ValueType>
-constexpr NamedTypeValueHelper<Tag, ValueType> NamedTypeV(ValueType value) {
-  return NamedTypeValueHelper<Tag, ValueType>(value);
+constexpr NamedTypeValueHelper<Tag, HelperValueT<ValueType>> NamedTypeV(ValueType&& value) noexcept(
+    std::is_lvalue_reference_v<ValueType> ||
+    std::is_nothrow_constructible_v<std::decay_t<ValueType>, ValueType>) {
+  return NamedTypeValueHelper<Tag, HelperValueT<ValueType>>{std::forward<ValueType>(value)};
+}
+
+/**
+ * @brief A helper to associate a value constructed in place with a named type for use in
+ * make_tuple
+ * @tparam Tag StringLiteral element name
+ * @tparam Type type of value
+ * @tparam Args types of constructor arguments
+ * @param args arguments to construct the value from
+ * @return a NamedTypeValueHelper object that constructs the value directly in the tuple
+ */
+template <StringLiteral Tag, typename Type, typename... Args>
+constexpr NamedTypeValueHelper<Tag, InPlaceConstruct<Type, Args...>> NamedTypeEmplace(
+    Args&&... args) noexcept {
+  return NamedTypeValueHelper<Tag, InPlaceConstruct<Type, Args...>>{
+      InPlaceConstruct<Type, Args...>{std::forward_as_tuple(std::forward<Args>(args)...)}};
 }
 
 /**
@@ -187,6 +384,355 @@ struct ExtractType<NamedType<Key, Type>> {
   using type = Type;
 };
 
+/**
+ * @brief Base template of helper template to give a NamedType a different type
+ * @tparam Named unconstrained type
+ * @tparam Type new type
+ */
+template <typename Named, typename Type>
+struct RebindType;
+
+/**
+ * @brief Partially specialized helper template
+ * @tparam Key key part of NamedType
+ * @tparam Old type part of NamedType
+ * @tparam Type new type
+ */
+template <StringLiteral Key, typename Old, typename Type>
+struct RebindType<NamedType<Key, Old>, Type> {
+  using type = NamedType<Key, Type>;
+};
+
+/**
+ * @brief Base template of helper template to give a NamedType whose tag is From the tag To
+ * @tparam Named unconstrained type
+ * @tparam From tag to replace
+ * @tparam To replacement tag
+ */
+template <typename Named, StringLiteral From, StringLiteral To>
+struct RenameTag;
+
+/**
+ * @brief Partially specialized helper template
+ * @tparam Key key part of NamedType
+ * @tparam Type type part of NamedType
+ * @tparam From tag to replace
+ * @tparam To replacement tag
+ */
+template <StringLiteral Key, typename Type, StringLiteral From, StringLiteral To>
+struct RenameTag<NamedType<Key, Type>, From, To> {
+  using type = std::conditional_t<Key == From, NamedType<To, Type>, NamedType<Key, Type>>;
+};
+
+/**
+ * @brief Compute the 64-bit FNV-1a hash of a string
+ * @param str string to hash
+ * @return the hash of str
+ */
+[[nodiscard]] constexpr std::uint64_t fnv1a_hash(std::string_view str) noexcept {
+  std::uint64_t hash{0xcbf29ce484222325ULL};
+  for (const char ch : str) {
+    hash ^= static_cast<std::uint8_t>(ch);
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+/**
+ * @brief An entry in a TagIndexTable associating the hash of a tag with its index in the pack
+ */
+struct TagIndexEntry {
+  std::uint64_t hash;
+  std::string_view tag;
+  std::size_t index;
+};
+
+/**
+ * @brief A compile time lookup table from the tags of a pack of NamedType types to their indices
+ *
+ * The entries are sorted by the hash of their tag once per pack, so every lookup is a binary search
+ * over integers followed by a single string comparison, and uniqueness can be determined by only
+ * comparing neighbouring entries.
+ *
+ * @tparam NamedTypes pack of NamedType types
+ */
+template <typename... NamedTypes>
+struct TagIndexTable {
+  static constexpr std::size_t count{sizeof...(NamedTypes)};
+
+  static constexpr std::array<TagIndexEntry, count> entries = [] {
+    std::size_t index{0};
+    std::array<TagIndexEntry, count> result{
+        TagIndexEntry{fnv1a_hash(NamedTypes::name()), NamedTypes::name(), index++}...};
+    std::sort(result.begin(), result.end(), [](const auto& lhs, const auto& rhs) {
+      return lhs.hash < rhs.hash || (lhs.hash == rhs.hash && lhs.tag < rhs.tag);
+    });
+    return result;
+  }();
+
+  static constexpr bool unique = [] {
+    for (std::size_t i{1}; i < count; i++) {
+      if (entries[i - 1].hash == entries[i].hash && entries[i - 1].tag == entries[i].tag) {
+        return false;
+      }
+    }
+    return true;
+  }();
+
+  /**
+   * @brief Find the index of the element whose tag is equal to tag
+   * @param tag tag to search for
+   * @return the index of the element with the tag if it exists; otherwise count
+   */
+  [[nodiscard]] static constexpr std::size_t find(std::string_view tag) noexcept {
+    const std::uint64_t hash{fnv1a_hash(tag)};
+    const auto* it = std::lower_bound(
+        entries.begin(), entries.end(), hash,
+        [](const TagIndexEntry& entry, std::uint64_t value) { return entry.hash < value; });
+    for (; it != entries.end() && it->hash == hash; ++it) {
+      if (it->tag == tag) { return it->index; }
+    }
+    return count;
+  }
+};
+
+/**
+ * @brief The index of the NamedType with the tag Key in a pack of NamedType types, or the size of
+ * the pack if there is no such NamedType
+ *
+ * Unlike key_index, this takes the NamedType types directly instead of NamedType non-types, which
+ * avoids deducing the type of every element of the pack for each lookup.
+ *
+ * @tparam Key StringLiteral tag to search for
+ * @tparam NamedTypes pack of NamedType types
+ */
+template <StringLiteral Key, typename... NamedTypes>
+inline constexpr std::size_t key_index_v{
+    TagIndexTable<NamedTypes...>::find(std::string_view{Key.value, Key.size - 1})};
+
+/**
+ * @brief Whether Key is one of the tags of a NamedType within the NamedTypes pack
+ * @tparam Key key to search for
+ * @tparam NamedTypes pack of NamedType types
+ */
+template <StringLiteral Key, typename... NamedTypes>
+inline constexpr bool is_one_of_v{key_index_v<Key, NamedTypes...> != sizeof...(NamedTypes)};
+
+/**
+ * @brief Whether all NamedTypes within the pack have unique tags
+ * @tparam NamedTypes pack of NamedType types
+ */
+template <typename... NamedTypes>
+inline constexpr bool all_unique_v{TagIndexTable<NamedTypes...>::unique};
+
+/**
+ * @brief Mix the bits of a 64-bit integer, this is the finalizer of MurmurHash3
+ * @param value value to mix
+ * @return the mixed value
+ */
+[[nodiscard]] constexpr std::uint64_t mix64(std::uint64_t value) noexcept {
+  value ^= value >> 33U;
+  value *= 0xff51afd7ed558ccdULL;
+  value ^= value >> 33U;
+  value *= 0xc4ceb9fe1a85ec53ULL;
+  value ^= value >> 33U;
+  return value;
+}
+
+/**
+ * @brief Get the name of a type as spelled by the compiler, which differs between compilers, so it
+ * is only stable across builds made with the same compiler
+ * @tparam Type type to name
+ * @return the name of Type
+ */
+template <typename Type>
+[[nodiscard]] constexpr std::string_view type_name() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+  constexpr std::string_view kSignature{__FUNCSIG__};
+  constexpr std::string_view kPrefix{"type_name<"};
+  constexpr std::size_t kBegin{kSignature.find(kPrefix) + kPrefix.size()};
+  constexpr std::size_t kEnd{kSignature.rfind(">(void)")};
+#else
+  // GCC: "... type_name() [with Type = int; std::string_view = ...]", Clang: "... [Type = int]"
+  constexpr std::string_view kSignature{__PRETTY_FUNCTION__};
+  constexpr std::string_view kPrefix{"Type = "};
+  constexpr std::size_t kBegin{kSignature.find(kPrefix) + kPrefix.size()};
+  constexpr std::size_t kEnd{kSignature.find(';', kBegin) == std::string_view::npos
+                                 ? kSignature.size() - 1
+                                 : kSignature.find(';', kBegin)};
+#endif
+  return kSignature.substr(kBegin, kEnd - kBegin);
+}
+
+/**
+ * @brief Kinds of types described by kind and size alone in a schema hash
+ */
+enum class TypeKind : std::uint8_t {
+  kOther,
+  kBoolean,
+  kCharacter,
+  kSignedInteger,
+  kUnsignedInteger,
+  kFloatingPoint,
+  kEnumeration,
+  kArray
+};
+
+/**
+ * @brief Hash a description of a type for a schema hash
+ *
+ * Arithmetic types are described by their kind, signedness and size, enumerations by the
+ * description of their underlying type and arrays by the description of their element type and
+ * their extent, so std::int64_t hashes the same whether it is spelled long or long long. Other
+ * types are described by their name, which only matches across builds made with the same compiler.
+ *
+ * @tparam Type type to describe
+ * @return a hash of the description of Type
+ */
+template <typename Type>
+[[nodiscard]] constexpr std::uint64_t type_hash() noexcept {
+  using Value = std::remove_cv_t<Type>;
+  constexpr auto describe = [](TypeKind kind, std::uint64_t detail) {
+    return mix64((static_cast<std::uint64_t>(kind) << 56U) ^ detail);
+  };
+  if constexpr (std::is_enum_v<Value>) {
+    return describe(TypeKind::kEnumeration, type_hash<std::underlying_type_t<Value>>());
+  } else if constexpr (std::is_same_v<Value, bool>) {
+    return describe(TypeKind::kBoolean, sizeof(Value));
+  } else if constexpr (std::is_same_v<Value, char> || std::is_same_v<Value, wchar_t> ||
+                       std::is_same_v<Value, char8_t> || std::is_same_v<Value, char16_t> ||
+                       std::is_same_v<Value, char32_t>) {
+    return describe(TypeKind::kCharacter, sizeof(Value));
+  } else if constexpr (std::is_integral_v<Value>) {
+    return describe(std::is_signed_v<Value> ? TypeKind::kSignedInteger : TypeKind::kUnsignedInteger,
+                    sizeof(Value));
+  } else if constexpr (std::is_floating_point_v<Value>) {
+    return describe(TypeKind::kFloatingPoint, sizeof(Value));
+  } else if constexpr (std::is_bounded_array_v<Value>) {
+    return describe(TypeKind::kArray,
+                    mix64(type_hash<std::remove_extent_t<Value>>() ^ std::extent_v<Value>));
+  } else if constexpr (requires {
+                         requires std::is_same_v<Value,
+                                                 std::array<typename Value::value_type,
+                                                            std::tuple_size<Value>::value>>;
+                       }) {
+    return describe(TypeKind::kArray,
+                    mix64(type_hash<typename Value::value_type>() ^ std::tuple_size_v<Value>));
+  } else {
+    return describe(TypeKind::kOther, fnv1a_hash(type_name<Value>()));
+  }
+}
+
+/**
+ * @brief A minimal perfect hash from the tags of a pack of NamedType types to their indices,
+ * generated at compile time for looking up tags that are only known at run time
+ *
+ * This uses hash and displace: the FNV-1a hash of a tag selects a bucket, and the displacement
+ * chosen for that bucket at compile time maps every tag of the bucket to its own slot. A lookup is
+ * one hash of the input, two table reads and a single string comparison.
+ *
+ * This is only instantiated by the run time lookup functions, so tuples that are only accessed
+ * with compile time tags don't pay for building it.
+ *
+ * @tparam NamedTypes pack of NamedType types with unique tags
+ */
+template <typename... NamedTypes>
+struct PerfectTagHash {
+  static constexpr std::size_t count{sizeof...(NamedTypes)};
+  static constexpr std::size_t slot_count{std::bit_ceil(std::max<std::size_t>(count * 2, 1))};
+  static constexpr std::size_t bucket_count{std::bit_ceil(std::max<std::size_t>(count / 4, 1))};
+
+  /**
+   * @brief The generated tables
+   */
+  struct Layout {
+    std::array<std::uint64_t, count> hashes;
+    std::array<std::string_view, count> tags;
+    std::array<std::uint32_t, bucket_count> displacements;
+    std::array<std::uint32_t, slot_count> slots;
+    bool valid;
+  };
+
+  [[nodiscard]] static constexpr std::size_t bucket_of(std::uint64_t hash) noexcept {
+    return static_cast<std::size_t>(mix64(hash)) & (bucket_count - 1);
+  }
+
+  [[nodiscard]] static constexpr std::size_t slot_of(std::uint64_t hash,
+                                                     std::uint32_t displacement) noexcept {
+    return static_cast<std::size_t>(mix64(hash + (displacement + 1ULL) * 0x9e3779b97f4a7c15ULL)) &
+           (slot_count - 1);
+  }
+
+  static constexpr Layout layout = [] {
+    constexpr std::uint32_t max_displacement{1U << 16U};
+    constexpr auto empty = static_cast<std::uint32_t>(count);
+
+    Layout result{{fnv1a_hash(NamedTypes::name())...}, {NamedTypes::name()...}, {}, {}, true};
+    result.slots.fill(empty);
+
+    // group the indices of the tags by bucket, visiting the largest buckets first
+    std::array<std::size_t, bucket_count> bucket_sizes{};
+    for (const std::uint64_t hash : result.hashes) { ++bucket_sizes[bucket_of(hash)]; }
+
+    std::array<std::size_t, count> by_bucket{};
+    for (std::size_t i{0}; i < count; i++) { by_bucket[i] = i; }
+    std::sort(by_bucket.begin(), by_bucket.end(), [&](std::size_t lhs, std::size_t rhs) {
+      const std::size_t lhs_bucket{bucket_of(result.hashes[lhs])};
+      const std::size_t rhs_bucket{bucket_of(result.hashes[rhs])};
+      if (bucket_sizes[lhs_bucket] != bucket_sizes[rhs_bucket]) {
+        return bucket_sizes[lhs_bucket] > bucket_sizes[rhs_bucket];
+      }
+      return lhs_bucket < rhs_bucket;
+    });
+
+    std::array<std::size_t, count> placed{};
+    for (std::size_t first{0}; first < count;) {
+      const std::size_t bucket{bucket_of(result.hashes[by_bucket[first]])};
+      const std::size_t last{first + bucket_sizes[bucket]};
+      for (std::uint32_t displacement{0};; displacement++) {
+        if (displacement == max_displacement) {
+          result.valid = false;
+          return result;
+        }
+        std::size_t placed_count{0};
+        for (std::size_t i{first}; i < last; i++) {
+          const std::size_t slot{slot_of(result.hashes[by_bucket[i]], displacement)};
+          if (result.slots[slot] != empty) { break; }
+          result.slots[slot] = static_cast<std::uint32_t>(by_bucket[i]);
+          placed[placed_count++] = slot;
+        }
+        if (placed_count == last - first) {
+          result.displacements[bucket] = displacement;
+          break;
+        }
+        for (std::size_t i{0}; i < placed_count; i++) { result.slots[placed[i]] = empty; }
+      }
+      first = last;
+    }
+    return result;
+  }();
+
+  static_assert(layout.valid, "Failed to generate a perfect hash for the tags of this pack");
+
+  /**
+   * @brief Find the index of the element whose tag is equal to tag
+   * @param tag tag to search for
+   * @return the index of the element with the tag if it exists; otherwise count
+   */
+  [[nodiscard]] static constexpr std::size_t find(std::string_view tag) noexcept {
+    if constexpr (count == 0) {
+      return count;
+    } else {
+      const std::uint64_t hash{fnv1a_hash(tag)};
+      const std::size_t index{layout.slots[slot_of(hash, layout.displacements[bucket_of(hash)])]};
+      if (index == count || layout.hashes[index] != hash || layout.tags[index] != tag) {
+        return count;
+      }
+      return index;
+    }
+  }
+};
+
 /**
  * @brief Find the index of a NamedType in a pack of NamedType non-types
  *
@@ -198,14 +744,7 @@ struct ExtractType<NamedType<Key, Type>> {
  */
 template <NamedType Needle, NamedType... Haystack>
 constexpr std::size_t key_index() {
-  std::size_t index{0};
-  ([&index]<NamedType Type>() {
-    if (Needle == Type) { return false; }
-    ++index;
-    return true;
-  }.template operator()<Haystack>() &&
-   ...);
-  return index;
+  return TagIndexTable<decltype(Haystack)...>::find(Needle.name());
 }
 
 /**
@@ -219,14 +758,7 @@ constexpr std::size_t key_index() {
  */
 template <StringLiteral Needle, NamedType... Haystack>
 constexpr std::size_t key_index() {
-  std::size_t index{0};
-  ([&index]<NamedType Type>() {
-    if (Needle == Type) { return false; }
-    ++index;
-    return true;
-  }.template operator()<Haystack>() &&
-   ...);
-  return index;
+  return key_index_v<Needle, decltype(Haystack)...>;
 }
 
 /**
@@ -236,23 +768,7 @@ constexpr std::size_t key_index() {
  */
 template <NamedType... NamedTypes>
 constexpr bool all_unique() {
-  if constexpr (sizeof...(NamedTypes) == 0) {
-    return true;
-  } else {
-    bool seen[sizeof...(NamedTypes)] = {false};
-
-    (
-        [&seen]<NamedType Type>() {
-          seen[key_index<Type, NamedTypes...>()] = true;
-        }.template operator()<NamedTypes>(),
-        ...);
-
-    for (std::size_t i{0}; i < sizeof...(NamedTypes); i++) {
-      if (!seen[i]) { return false; }
-    }
-
-    return true;
-  }
+  return all_unique_v<decltype(NamedTypes)...>;
 }
 
 /**
@@ -285,6 +801,153 @@ constexpr auto SynthThreeWay = []<class T, class U>(const T& t, const U& u)
 template <class T, class U = T>
 using SynthThreeWayResultT = decltype(SynthThreeWay(std::declval<T&>(), std::declval<U&>()));
 
+/**
+ * @brief Whether a type is an array of bytes, which orders lexicographically like its memory
+ * @tparam Type type to check
+ */
+template <typename Type>
+inline constexpr bool is_byte_array_v{false};
+
+/**
+ * @brief Specialization for std::array of unsigned character types and std::byte
+ * @tparam Byte type of the array elements
+ * @tparam Size number of elements
+ */
+template <typename Byte, std::size_t Size>
+inline constexpr bool is_byte_array_v<std::array<Byte, Size>>{
+    std::is_same_v<Byte, unsigned char> || std::is_same_v<Byte, std::byte> ||
+    std::is_same_v<Byte, char8_t>};
+
+/**
+ * @brief SynthThreeWay that compares two byte arrays of the same type with a single memcmp
+ * @tparam T Lhs type
+ * @tparam U Rhs type
+ * @param t lhs
+ * @param u rhs
+ */
+constexpr auto ElementThreeWay = []<class T, class U>(const T& t, const U& u)
+  requires requires { SynthThreeWay(t, u); }
+{
+  if constexpr (std::is_same_v<T, U> && is_byte_array_v<T>) {
+    if (!std::is_constant_evaluated()) { return std::memcmp(t.data(), u.data(), t.size()) <=> 0; }
+  }
+  return SynthThreeWay(t, u);
+};
+
+/**
+ * @brief Whether the equality of a type is the equality of its bytes, which holds for integral and
+ * enumeration types, including std::byte, but not for class types that may define their own
+ * operator== even when they have a unique object representation
+ * @tparam Type type to check
+ */
+template <typename Type>
+inline constexpr bool bytewise_equality_v{(std::is_integral_v<Type> || std::is_enum_v<Type>) &&
+                                          std::has_unique_object_representations_v<Type>};
+
+/**
+ * @brief Specialization for std::array, whose equality is the equality of its elements
+ * @tparam Type type of the array elements
+ * @tparam Size number of elements
+ */
+template <typename Type, std::size_t Size>
+inline constexpr bool bytewise_equality_v<std::array<Type, Size>>{bytewise_equality_v<Type>};
+
+/**
+ * @brief Whether two objects holding elements of types Types are equal exactly when their bytes
+ * are equal, which requires the equality of every element to be bytewise and the object to have
+ * no padding
+ * @tparam Object type of object holding the elements
+ * @tparam Types types of the elements
+ */
+template <typename Object, typename... Types>
+inline constexpr bool byte_comparable_v{(bytewise_equality_v<Types> && ...) &&
+                                        sizeof(Object) == (std::size_t{0} + ... + sizeof(Types))};
+
+/**
+ * @brief Whether more than one unsigned integer of types Types fit in a single 64-bit unsigned
+ * integer, so they can be ordered lexicographically with a single comparison
+ * @tparam Types types of the integers
+ */
+template <typename... Types>
+inline constexpr bool packed_comparable_v{
+    sizeof...(Types) > 1 && (std::is_integral_v<Types> && ...) &&
+    (std::is_unsigned_v<Types> && ...) &&
+    (std::size_t{0} + ... + sizeof(Types)) <= sizeof(std::uint64_t)};
+
+/**
+ * @brief Pack unsigned integers into one 64-bit unsigned integer, the first in the most significant
+ * bits, that orders like the integers in lexicographical order
+ * @tparam Types types of the integers
+ * @param values integers to pack
+ * @return the packed integer
+ */
+template <typename... Types>
+  requires(packed_comparable_v<Types...>)
+[[nodiscard]] constexpr std::uint64_t pack_unsigned(const Types&... values) noexcept {
+  std::uint64_t packed{0};
+  ((packed = (packed << (8 * sizeof(Types))) | static_cast<std::uint64_t>(values)), ...);
+  return packed;
+}
+
+/**
+ * @brief Three way compare two NamedTuple like objects lexicographically by the elements named
+ * Tags, in the order the tags are given
+ *
+ * Elements that are unsigned integers fitting in 64 bits together are packed and compared at once,
+ * byte arrays are compared with memcmp and everything else with synth-three-way.
+ *
+ * @tparam Tags tags of the elements to compare
+ * @tparam Lhs type of left hand side
+ * @tparam Rhs type of right hand side
+ * @param lhs left hand side
+ * @param rhs right hand side
+ * @return the relation between the first pair of non-equivalent elements if there is any;
+ * otherwise equal
+ */
+template <StringLiteral... Tags, typename Lhs, typename Rhs>
+  requires(sizeof...(Tags) > 0)
+[[nodiscard]] constexpr auto compare_by(const Lhs& lhs, const Rhs& rhs) {
+  if constexpr (packed_comparable_v<std::remove_cvref_t<decltype(lhs.template get<Tags>())>...> &&
+                (std::is_same_v<std::remove_cvref_t<decltype(lhs.template get<Tags>())>,
+                                std::remove_cvref_t<decltype(rhs.template get<Tags>())>> &&
+                 ...)) {
+    return pack_unsigned(lhs.template get<Tags>()...) <=>
+           pack_unsigned(rhs.template get<Tags>()...);
+  } else {
+    std::common_comparison_category_t<decltype(ElementThreeWay(lhs.template get<Tags>(),
+                                                               rhs.template get<Tags>()))...>
+        result = std::strong_ordering::equivalent;
+    ([&lhs, &rhs, &result]<StringLiteral Tag>() {
+      result = ElementThreeWay(lhs.template get<Tag>(), rhs.template get<Tag>());
+      return result != 0;
+    }.template operator()<Tags>() ||
+     ...);
+    return result;
+  }
+}
+
+/**
+ * @brief A function object that three way compares NamedTuple like objects lexicographically by the
+ * elements named Tags, in the order the tags are given
+ * @tparam Tags tags of the elements to compare
+ */
+template <StringLiteral... Tags>
+  requires(sizeof...(Tags) > 0)
+struct CompareBy {
+  /**
+   * @brief Compare two NamedTuple like objects
+   * @tparam Lhs type of left hand side
+   * @tparam Rhs type of right hand side
+   * @param lhs left hand side
+   * @param rhs right hand side
+   * @return the result of compare_by
+   */
+  template <typename Lhs, typename Rhs>
+  [[nodiscard]] constexpr auto operator()(const Lhs& lhs, const Rhs& rhs) const {
+    return compare_by<Tags...>(lhs, rhs);
+  }
+};
+
 /**
  * @brief Check if Key is one of the tags of a NamedType within the NamedTypes pack
  * @tparam Key key to search for
@@ -293,15 +956,114 @@ using SynthThreeWayResultT = decltype(SynthThreeWay(std::declval<T&>(), std::dec
  */
 template <StringLiteral Key, NamedType... NamedTypes>
 constexpr bool is_one_of() {
-  return (... || (Key == NamedTypes));
+  return is_one_of_v<Key, decltype(NamedTypes)...>;
+}
+
+/**
+ * @brief The kind of access recorded by the access counters
+ */
+enum class FieldAccess : std::uint8_t { kGet, kSet };
+
+#if defined(NAMED_TUPLE_ACCESS_COUNTERS)
+/**
+ * @brief A function called on every counted access with the name and index of the element
+ */
+using AccessHook = void (*)(std::string_view name, std::size_t index,
+                           FieldAccess access) noexcept;
+
+/**
+ * @brief The number of counted accesses of an element of a NamedTuple
+ */
+struct FieldAccessCount {
+  std::string_view name;
+  std::uint64_t gets;
+  std::uint64_t sets;
+};
+
+/**
+ * @brief Holder of the installed AccessHook
+ */
+struct AccessHookSlot {
+  static inline std::atomic<AccessHook> hook{nullptr};
+};
+
+/**
+ * @brief Install a hook called on every counted access of every NamedTuple
+ * @param hook hook to install, or nullptr to remove the installed hook
+ * @return the previously installed hook
+ */
+inline AccessHook set_access_hook(AccessHook hook) noexcept {
+  return AccessHookSlot::hook.exchange(hook, std::memory_order_acq_rel);
 }
 
+/**
+ * @brief The access counters shared by every NamedTuple of the same NamedTypes, only defined when
+ * NAMED_TUPLE_ACCESS_COUNTERS is defined
+ *
+ * Every call of get or set by tag increments the counter of the element with a relaxed atomic
+ * increment, including the calls compare_by, hash_by and the algorithms make on behalf of the
+ * caller. Accesses by index, through which copies, serialization and the containers walk the
+ * elements, are not counted, and neither are accesses during constant evaluation.
+ *
+ * @tparam NamedTypes pack of NamedType of the NamedTuple
+ */
+template <typename... NamedTypes>
+class AccessCounters {
+public:
+  /**
+   * @brief Count an access of the element at index and pass it to the installed hook
+   * @param index index of the element
+   * @param access kind of access
+   */
+  static void record(std::size_t index, FieldAccess access) noexcept {
+    auto& counter = access == FieldAccess::kGet ? counters[index].gets : counters[index].sets;
+    counter.fetch_add(1, std::memory_order_relaxed);
+    if (const AccessHook hook = AccessHookSlot::hook.load(std::memory_order_acquire)) {
+      hook(kNames[index], index, access);
+    }
+  }
+
+  /**
+   * @brief Read the counters of every element
+   * @return the name and counts of every element in declared order
+   */
+  [[nodiscard]] static std::array<FieldAccessCount, sizeof...(NamedTypes)> snapshot() noexcept {
+    std::array<FieldAccessCount, sizeof...(NamedTypes)> result{};
+    for (std::size_t index{0}; index < result.size(); ++index) {
+      result[index] = {kNames[index], counters[index].gets.load(std::memory_order_relaxed),
+                       counters[index].sets.load(std::memory_order_relaxed)};
+    }
+    return result;
+  }
+
+  /**
+   * @brief Set the counters of every element to zero
+   */
+  static void reset() noexcept {
+    for (auto& counter : counters) {
+      counter.gets.store(0, std::memory_order_relaxed);
+      counter.sets.store(0, std::memory_order_relaxed);
+    }
+  }
+
+private:
+  struct Counter {
+    std::atomic<std::uint64_t> gets{0};
+    std::atomic<std::uint64_t> sets{0};
+  };
+
+  static constexpr std::array<std::string_view, sizeof...(NamedTypes)> kNames{
+      NamedTypes::name()...};
+  static inline std::array<Counter, sizeof...(NamedTypes)> counters{};
+};
+#endif
+
 /**
  * @brief A tuple whose elements can be looked up by name(string literal) along with type and index
  * @tparam NamedTypes pack of NamedType types with unique names
  */
 template <typename... NamedTypes>
-  requires(all_unique<NamedTypes{}...>())
+  requires(all_unique_v<NamedTypes...>)
 struct NamedTuple : std::tuple<typename ExtractType<NamedTypes>::type...> {
   using Base = std::tuple<typename ExtractType<NamedTypes>::type...>;
   using ConstBase = const std::tuple<typename ExtractType<NamedTypes>::type...>;
@@ -312,15 +1074,162 @@ struct NamedTuple : std::tuple<typename ExtractType<NamedTypes>::type...> {
    * @param init_values values to initialize each tuple element
    */
   template <typename... InitTypes>
+    requires(!starts_with_allocator_arg_v<InitTypes...> &&
+             (sizeof...(InitTypes) == 0 ||
+              !(is_value_helper_v<std::remove_cvref_t<InitTypes>> && ...)))
   constexpr explicit NamedTuple(InitTypes&&... init_values)
       : Base{std::forward<InitTypes>(init_values)...} {}
 
+  /**
+   * @brief Construct this NamedTuple value initializing all elements with uses-allocator
+   * construction
+   * @tparam Alloc type of allocator
+   * @param alloc allocator passed to every element that uses one
+   */
+  template <typename Alloc>
+  constexpr NamedTuple(std::allocator_arg_t, const Alloc& alloc)
+      : Base{std::allocator_arg, alloc} {}
+
+  /**
+   * @brief Construct this NamedTuple initializing all elements with uses-allocator construction
+   * @tparam Alloc type of allocator
+   * @tparam InitTypes types of initializer values
+   * @param alloc allocator passed to every element that uses one
+   * @param init_values values to initialize each tuple element
+   */
+  template <typename Alloc, typename... InitTypes>
+    requires(sizeof...(InitTypes) == sizeof...(NamedTypes) && sizeof...(InitTypes) > 0 &&
+             std::is_constructible_v<Base, std::allocator_arg_t, const Alloc&, InitTypes...>)
+  constexpr NamedTuple(std::allocator_arg_t, const Alloc& alloc, InitTypes&&... init_values)
+      : Base{std::allocator_arg, alloc, std::forward<InitTypes>(init_values)...} {}
+
+  /**
+   * @brief Copy construct this NamedTuple with uses-allocator construction of every element
+   * @tparam Alloc type of allocator
+   * @param alloc allocator passed to every element that uses one
+   * @param other NamedTuple to copy
+   */
+  template <typename Alloc>
+  constexpr NamedTuple(std::allocator_arg_t, const Alloc& alloc, const NamedTuple& other)
+      : Base{std::allocator_arg, alloc, static_cast<const Base&>(other)} {}
+
+  /**
+   * @brief Move construct this NamedTuple with uses-allocator construction of every element
+   * @tparam Alloc type of allocator
+   * @param alloc allocator passed to every element that uses one
+   * @param other NamedTuple to move from
+   */
+  template <typename Alloc>
+  constexpr NamedTuple(std::allocator_arg_t, const Alloc& alloc, NamedTuple&& other)
+      : Base{std::allocator_arg, alloc, static_cast<Base&&>(other)} {}
+
+  /**
+   * @brief Construct this NamedTuple from values associated with names by NamedTypeV or
+   * NamedTypeEmplace, in any order
+   *
+   * Every element is constructed exactly once, directly from its value if one was given for its
+   * name; otherwise it is value initialized.
+   *
+   * @tparam Helpers types of named type value helpers
+   * @param helpers values to initialize the named elements with
+   */
+  template <typename... Helpers>
+    requires(sizeof...(Helpers) > 0 && (is_value_helper_v<std::remove_cvref_t<Helpers>> && ...) &&
+             all_unique_v<typename std::remove_cvref_t<Helpers>::DecayT...> &&
+             ((TagIndexTable<NamedTypes...>::find(
+                   std::remove_cvref_t<Helpers>::DecayT::name()) != sizeof...(NamedTypes)) &&
+              ...))
+  constexpr explicit NamedTuple(Helpers&&... helpers)
+      : Base{named_init_value<NamedTypes>(std::forward<Helpers>(helpers)...)...} {}
+
+  /**
+   * @brief Construct this NamedTuple from values associated with names by NamedTypeV or
+   * NamedTypeEmplace, in any order, with uses-allocator construction of every element
+   * @tparam Alloc type of allocator
+   * @tparam Helpers types of named type value helpers
+   * @param alloc allocator passed to every element that uses one
+   * @param helpers values to initialize the named elements with
+   */
+  template <typename Alloc, typename... Helpers>
+    requires(sizeof...(Helpers) > 0 && (is_value_helper_v<std::remove_cvref_t<Helpers>> && ...) &&
+             all_unique_v<typename std::remove_cvref_t<Helpers>::DecayT...> &&
+             ((TagIndexTable<NamedTypes...>::find(
+                   std::remove_cvref_t<Helpers>::DecayT::name()) != sizeof...(NamedTypes)) &&
+              ...))
+  constexpr NamedTuple(std::allocator_arg_t, const Alloc& alloc, Helpers&&... helpers)
+      : Base{named_init_value_using_allocator<NamedTypes>(alloc,
+                                                          std::forward<Helpers>(helpers)...)...} {}
+
   /**
    * @brief Get the number of elements this NamedTuple holds
    * @return the number of elements this NamedTuple holds
    */
   [[nodiscard]] constexpr std::size_t size() const { return sizeof...(NamedTypes); }
 
+  /**
+   * @brief Find the index of the element whose name is only known at run time
+   *
+   * The lookup uses a perfect hash of the tags generated at compile time, so it costs one hash of
+   * name and a single string comparison regardless of the number of elements.
+   *
+   * @param name name of the element to search for
+   * @return the index of the element named name if there is one; otherwise std::nullopt
+   */
+  [[nodiscard]] static constexpr std::optional<std::size_t> index_of(
+      std::string_view name) noexcept {
+    const std::size_t index{PerfectTagHash<NamedTypes...>::find(name)};
+    if (index == sizeof...(NamedTypes)) { return std::nullopt; }
+    return index;
+  }
+
+  /**
+   * @brief Invoke visitor with the element at an index that is only known at run time
+   * @tparam Visitor type of visitor, invocable with every element type of this NamedTuple
+   * @param index index of the element to visit
+   * @param visitor visitor to invoke with a reference to the element
+   * @return true if index refers to an element and the visitor was invoked; otherwise false
+   */
+  template <typename Visitor>
+  constexpr bool visit_by_index(std::size_t index, Visitor&& visitor) & {
+    return visit_by_index_impl(*this, index, visitor);
+  }
+
+  /**
+   * @brief Invoke visitor with the element at an index that is only known at run time
+   * @tparam Visitor type of visitor, invocable with every element type of this NamedTuple
+   * @param index index of the element to visit
+   * @param visitor visitor to invoke with a const reference to the element
+   * @return true if index refers to an element and the visitor was invoked; otherwise false
+   */
+  template <typename Visitor>
+  constexpr bool visit_by_index(std::size_t index, Visitor&& visitor) const& {
+    return visit_by_index_impl(*this, index, visitor);
+  }
+
+  /**
+   * @brief Invoke visitor with the element whose name is only known at run time
+   * @tparam Visitor type of visitor, invocable with every element type of this NamedTuple
+   * @param name name of the element to visit
+   * @param visitor visitor to invoke with a reference to the element
+   * @return true if an element is named name and the visitor was invoked; otherwise false
+   */
+  template <typename Visitor>
+  constexpr bool visit_by_name(std::string_view name, Visitor&& visitor) & {
+    return visit_by_index_impl(*this, PerfectTagHash<NamedTypes...>::find(name), visitor);
+  }
+
+  /**
+   * @brief Invoke visitor with the element whose name is only known at run time
+   * @tparam Visitor type of visitor, invocable with every element type of this NamedTuple
+   * @param name name of the element to visit
+   * @param visitor visitor to invoke with a const reference to the element
+   * @return true if an element is named name and the visitor was invoked; otherwise false
+   */
+  template <typename Visitor>
+  constexpr bool visit_by_name(std::string_view name, Visitor&& visitor) const& {
+    return visit_by_index_impl(*this, PerfectTagHash<NamedTypes...>::find(name), visitor);
+  }
+
   /**
    * @brief Explicit conversion operator to Base
    * @return Const reference to Base
@@ -343,10 +1252,11 @@ struct NamedTuple : std::tuple<typename ExtractType<NamedTypes>::type...> {
    */
   template <StringLiteral Tag, typename Value>
     requires(
-        sizeof...(NamedTypes) > 0 && is_one_of<Tag, NamedTypes{}...>() &&
-        std::is_convertible_v<Value, std::tuple_element_t<key_index<Tag, NamedTypes{}...>(), Base>>)
+        sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...> &&
+        std::is_convertible_v<Value, std::tuple_element_t<key_index_v<Tag, NamedTypes...>, Base>>)
   constexpr void set(Value&& value) {
-    constexpr std::size_t Index = key_index<Tag, NamedTypes{}...>();
+    constexpr std::size_t Index = key_index_v<Tag, NamedTypes...>;
+    count_access<Index>(FieldAccess::kSet);
     std::get<Index>(static_cast<Base&>(*this)) = std::forward<Value>(value);
   }
 
@@ -356,9 +1266,10 @@ struct NamedTuple : std::tuple<typename ExtractType<NamedTypes>::type...> {
    * @return the element of the NamedTuple whose name is Tag
    */
   template <StringLiteral Tag>
-    requires(sizeof...(NamedTypes) > 0 && is_one_of<Tag, NamedTypes{}...>())
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
   [[nodiscard]] constexpr auto& get() & noexcept {
-    constexpr std::size_t Index = key_index<Tag, NamedTypes{}...>();
+    constexpr std::size_t Index = key_index_v<Tag, NamedTypes...>;
+    count_access<Index>(FieldAccess::kGet);
     return std::get<Index>(static_cast<Base&>(*this));
   }
 
@@ -368,9 +1279,10 @@ struct NamedTuple : std::tuple<typename ExtractType<NamedTypes>::type...> {
    * @return the element of the NamedTuple whose name is Tag
    */
   template <StringLiteral Tag>
-    requires(sizeof...(NamedTypes) > 0 && is_one_of<Tag, NamedTypes{}...>())
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
   [[nodiscard]] constexpr const auto& get() const& noexcept {
-    constexpr std::size_t Index = key_index<Tag, NamedTypes{}...>();
+    constexpr std::size_t Index = key_index_v<Tag, NamedTypes...>;
+    count_access<Index>(FieldAccess::kGet);
     return std::get<Index>(static_cast<const Base&>(*this));
   }
 
@@ -380,10 +1292,11 @@ struct NamedTuple : std::tuple<typename ExtractType<NamedTypes>::type...> {
    * @return the element of the NamedTuple whose name is Tag
    */
   template <StringLiteral Tag>
-    requires(sizeof...(NamedTypes) > 0 && is_one_of<Tag, NamedTypes{}...>())
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
   [[nodiscard]] constexpr auto&& get() && noexcept {
-    constexpr std::size_t Index = key_index<Tag, NamedTypes{}...>();
-    return std::get<Index>(static_cast<Base&>(*this));
+    constexpr std::size_t Index = key_index_v<Tag, NamedTypes...>;
+    count_access<Index>(FieldAccess::kGet);
+    return std::get<Index>(static_cast<Base&&>(*this));
   }
 
   /**
@@ -392,10 +1305,11 @@ struct NamedTuple : std::tuple<typename ExtractType<NamedTypes>::type...> {
    * @return the element of the NamedTuple whose name is Tag
    */
   template <StringLiteral Tag>
-    requires(sizeof...(NamedTypes) > 0 && is_one_of<Tag, NamedTypes{}...>())
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
   [[nodiscard]] constexpr const auto&& get() const&& noexcept {
-    constexpr std::size_t Index = key_index<Tag, NamedTypes{}...>();
-    return std::get<Index>(static_cast<const Base&>(*this));
+    constexpr std::size_t Index = key_index_v<Tag, NamedTypes...>;
+    count_access<Index>(FieldAccess::kGet);
+    return std::get<Index>(static_cast<const Base&&>(*this));
   }
 
   /**
@@ -428,7 +1342,7 @@ struct NamedTuple : std::tuple<typename ExtractType<NamedTypes>::type...> {
   template <std::size_t Index>
     requires(sizeof...(NamedTypes) > 0 && Index < sizeof...(NamedTypes))
   [[nodiscard]] constexpr auto&& get() && noexcept {
-    return std::get<Index>(static_cast<Base&>(*this));
+    return std::get<Index>(static_cast<Base&&>(*this));
   }
 
   /**
@@ -439,9 +1353,127 @@ struct NamedTuple : std::tuple<typename ExtractType<NamedTypes>::type...> {
   template <std::size_t Index>
     requires(sizeof...(NamedTypes) > 0 && Index < sizeof...(NamedTypes))
   [[nodiscard]] constexpr const auto&& get() const&& noexcept {
-    return std::get<Index>(static_cast<const Base&>(*this));
+    return std::get<Index>(static_cast<const Base&&>(*this));
+  }
+
+  /**
+   * @brief Get a NamedTuple of references to the elements named Tags, in the order of Tags
+   * @tparam Tags tags of the elements to select
+   * @return a NamedTuple of references to the selected elements
+   */
+  template <StringLiteral... Tags>
+    requires(sizeof...(Tags) > 0 && (is_one_of_v<Tags, NamedTypes...> && ...) &&
+             all_unique_v<NamedType<Tags, void>...>)
+  [[nodiscard]] constexpr auto select() & noexcept {
+    return reference_tuple<std::array<std::size_t, sizeof...(Tags)>{
+        key_index_v<Tags, NamedTypes...>...}>(*this);
+  }
+
+  /**
+   * @brief Get a NamedTuple of const references to the elements named Tags, in the order of Tags
+   * @tparam Tags tags of the elements to select
+   * @return a NamedTuple of const references to the selected elements
+   */
+  template <StringLiteral... Tags>
+    requires(sizeof...(Tags) > 0 && (is_one_of_v<Tags, NamedTypes...> && ...) &&
+             all_unique_v<NamedType<Tags, void>...>)
+  [[nodiscard]] constexpr auto select() const& noexcept {
+    return reference_tuple<std::array<std::size_t, sizeof...(Tags)>{
+        key_index_v<Tags, NamedTypes...>...}>(*this);
   }
 
+  /**
+   * @brief Selecting from a temporary would return dangling references
+   * @tparam Tags tags of the elements to select
+   */
+  template <StringLiteral... Tags>
+  void select() && = delete;
+
+  /**
+   * @brief Selecting from a temporary would return dangling references
+   * @tparam Tags tags of the elements to select
+   */
+  template <StringLiteral... Tags>
+  void select() const&& = delete;
+
+  /**
+   * @brief Get a NamedTuple of references to every element except the ones named Tags
+   * @tparam Tags tags of the elements to leave out
+   * @return a NamedTuple of references to the remaining elements in declared order
+   */
+  template <StringLiteral... Tags>
+    requires((is_one_of_v<Tags, NamedTypes...> && ...) && all_unique_v<NamedType<Tags, void>...>)
+  [[nodiscard]] constexpr auto drop() & noexcept {
+    return reference_tuple<kept_indices<Tags...>()>(*this);
+  }
+
+  /**
+   * @brief Get a NamedTuple of const references to every element except the ones named Tags
+   * @tparam Tags tags of the elements to leave out
+   * @return a NamedTuple of const references to the remaining elements in declared order
+   */
+  template <StringLiteral... Tags>
+    requires((is_one_of_v<Tags, NamedTypes...> && ...) && all_unique_v<NamedType<Tags, void>...>)
+  [[nodiscard]] constexpr auto drop() const& noexcept {
+    return reference_tuple<kept_indices<Tags...>()>(*this);
+  }
+
+  /**
+   * @brief Dropping from a temporary would return dangling references
+   * @tparam Tags tags of the elements to leave out
+   */
+  template <StringLiteral... Tags>
+  void drop() && = delete;
+
+  /**
+   * @brief Dropping from a temporary would return dangling references
+   * @tparam Tags tags of the elements to leave out
+   */
+  template <StringLiteral... Tags>
+  void drop() const&& = delete;
+
+  /**
+   * @brief Get a NamedTuple of references to every element where the element named From is
+   * named To instead
+   * @tparam From tag of the element to rename
+   * @tparam To new tag of the element, must not be the tag of another element
+   * @return a NamedTuple of references to every element in declared order
+   */
+  template <StringLiteral From, StringLiteral To>
+    requires(is_one_of_v<From, NamedTypes...> && (From == To || !is_one_of_v<To, NamedTypes...>))
+  [[nodiscard]] constexpr auto rename() & noexcept {
+    return rename_impl<From, To>(*this);
+  }
+
+  /**
+   * @brief Get a NamedTuple of const references to every element where the element named From is
+   * named To instead
+   * @tparam From tag of the element to rename
+   * @tparam To new tag of the element, must not be the tag of another element
+   * @return a NamedTuple of const references to every element in declared order
+   */
+  template <StringLiteral From, StringLiteral To>
+    requires(is_one_of_v<From, NamedTypes...> && (From == To || !is_one_of_v<To, NamedTypes...>))
+  [[nodiscard]] constexpr auto rename() const& noexcept {
+    return rename_impl<From, To>(*this);
+  }
+
+  /**
+   * @brief Renaming a temporary would return dangling references
+   * @tparam From tag of the element to rename
+   * @tparam To new tag of the element
+   */
+  template <StringLiteral From, StringLiteral To>
+  void rename() && = delete;
+
+  /**
+   * @brief Renaming a temporary would return dangling references
+   * @tparam From tag of the element to rename
+   * @tparam To new tag of the element
+   */
+  template <StringLiteral From, StringLiteral To>
+  void rename() const&& = delete;
+
   /**
    * @brief Element-wise comparison of the elements in this NamedTuple with elements in the other
    * NamedTuple
@@ -460,6 +1492,12 @@ struct NamedTuple : std::tuple<typename ExtractType<NamedTypes>::type...> {
   template <typename... OtherNamedTypes>
   [[nodiscard]] constexpr bool operator==(const NamedTuple<OtherNamedTypes...>& other) const {
     static_assert(sizeof...(NamedTypes) == sizeof...(OtherNamedTypes));
+    if constexpr (std::is_same_v<NamedTuple, NamedTuple<OtherNamedTypes...>> &&
+                  sizeof...(NamedTypes) > 0 &&
+                  byte_comparable_v<NamedTuple, typename ExtractType<NamedTypes>::type...>) {
+      // without padding and with unique object representations equal values have equal bytes
+      if (!std::is_constant_evaluated()) { return std::memcmp(this, &other, sizeof(*this)) == 0; }
+    }
     return ((this->get<NamedTypes{}.tag()>() == other.template get<NamedTypes{}.tag()>()) && ...);
   }
 
@@ -503,21 +1541,193 @@ struct NamedTuple : std::tuple<typename ExtractType<NamedTypes>::type...> {
     static_assert(sizeof...(NamedTypes) == sizeof...(OtherNamedTypes));
     if constexpr (sizeof...(NamedTypes) == 0 && sizeof...(OtherNamedTypes) == 0) {
       return std::strong_ordering::equal;
+    } else {
+      return compare_by<NamedTypes{}.tag()...>(*this, other);
     }
+  }
 
-    std::common_comparison_category_t<SynthThreeWayResultT<
-        typename ExtractType<NamedTypes>::type, typename ExtractType<OtherNamedTypes>::type>...>
-        result = std::strong_ordering::equivalent;
-
-    ([this, &other, &result]<StringLiteral Tag>() {
-      result = SynthThreeWay(this->get<Tag>(), other.template get<Tag>());
-      return result != 0;
-    }.template operator()<NamedTypes{}.tag()>() ||
-     ...);
+private:
+  /**
+   * @brief Count an access of the element at Index when NAMED_TUPLE_ACCESS_COUNTERS is defined,
+   * otherwise do nothing
+   * @tparam Index index of the element
+   * @param access kind of access
+   */
+  template <std::size_t Index>
+  static constexpr void count_access([[maybe_unused]] FieldAccess access) noexcept {
+#if defined(NAMED_TUPLE_ACCESS_COUNTERS)
+    if (!std::is_constant_evaluated()) { AccessCounters<NamedTypes...>::record(Index, access); }
+#endif
+  }
 
+  /**
+   * @brief Compute the indices of the elements whose tags are not one of Tags
+   * @tparam Tags tags of the elements to leave out
+   * @return the indices of the remaining elements in declared order
+   */
+  template <StringLiteral... Tags>
+  [[nodiscard]] static constexpr auto kept_indices() noexcept {
+    std::array<std::size_t, sizeof...(NamedTypes) - sizeof...(Tags)> result{};
+    using Dropped = TagIndexTable<NamedType<Tags, void>...>;
+    const std::array<bool, sizeof...(NamedTypes)> dropped{
+        (Dropped::find(NamedTypes::name()) != sizeof...(Tags))...};
+    std::size_t count{0};
+    for (std::size_t index{0}; index < dropped.size(); ++index) {
+      if (!dropped[index]) { result[count++] = index; }
+    }
     return result;
   }
+
+  /**
+   * @brief Build a NamedTuple of references to the elements of self at Indices
+   * @tparam Indices indices of the elements to refer to
+   * @tparam Self type of this NamedTuple, possibly const
+   * @param self NamedTuple to refer to
+   * @return a NamedTuple of references to the elements at Indices
+   */
+  template <auto Indices, typename Self>
+  [[nodiscard]] static constexpr auto reference_tuple(Self& self) noexcept {
+    return [&self]<std::size_t... Positions>(std::index_sequence<Positions...>) {
+      return NamedTuple<typename RebindType<
+          std::tuple_element_t<Indices[Positions], std::tuple<NamedTypes...>>,
+          decltype(self.template get<Indices[Positions]>())>::type...>{
+          self.template get<Indices[Positions]>()...};
+    }(std::make_index_sequence<Indices.size()>{});
+  }
+
+  /**
+   * @brief Build a NamedTuple of references to every element of self where From is renamed To
+   * @tparam From tag of the element to rename
+   * @tparam To new tag of the element
+   * @tparam Self type of this NamedTuple, possibly const
+   * @param self NamedTuple to refer to
+   * @return a NamedTuple of references to every element in declared order
+   */
+  template <StringLiteral From, StringLiteral To, typename Self>
+  [[nodiscard]] static constexpr auto rename_impl(Self& self) noexcept {
+    return [&self]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+      return NamedTuple<typename RenameTag<
+          typename RebindType<std::tuple_element_t<Indices, std::tuple<NamedTypes...>>,
+                              decltype(self.template get<Indices>())>::type,
+          From, To>::type...>{self.template get<Indices>()...};
+    }(std::index_sequence_for<NamedTypes...>{});
+  }
+
+  /**
+   * @brief Select the initializer of an element from the named type value helpers passed to the
+   * named constructor
+   * @tparam Element NamedType of the element to initialize
+   * @tparam Helpers types of named type value helpers
+   * @param helpers values to initialize the named elements with
+   * @return the value associated with the name of Element if there is one; otherwise an object
+   * that value initializes the element
+   */
+  template <typename Element, typename... Helpers>
+  [[nodiscard]] static constexpr decltype(auto) named_init_value(Helpers&&... helpers) {
+    using Type = typename ExtractType<Element>::type;
+    constexpr std::size_t index{
+        TagIndexTable<typename std::remove_cvref_t<Helpers>::DecayT...>::find(Element::name())};
+    if constexpr (index == sizeof...(Helpers) && constructible_from_any_v<Type>) {
+      // the converting constructor of Type would capture an InPlaceConstruct
+      return Type{};
+    } else if constexpr (index == sizeof...(Helpers)) {
+      return InPlaceConstruct<Type>{};
+    } else {
+      return forward_value(
+          std::get<index>(std::forward_as_tuple(std::forward<Helpers>(helpers)...)));
+    }
+  }
+
+  /**
+   * @brief Construct the value of an element with uses-allocator construction from the named type
+   * value helpers passed to the allocator-extended named constructor
+   * @tparam Element NamedType of the element to initialize
+   * @tparam Alloc type of allocator
+   * @tparam Helpers types of named type value helpers
+   * @param alloc allocator passed to the element if it uses one
+   * @param helpers values to initialize the named elements with
+   * @return the value of the element, or a reference for reference elements
+   */
+  template <typename Element, typename Alloc, typename... Helpers>
+  [[nodiscard]] static constexpr decltype(auto) named_init_value_using_allocator(
+      const Alloc& alloc, Helpers&&... helpers) {
+    using Type = typename ExtractType<Element>::type;
+    constexpr std::size_t index{
+        TagIndexTable<typename std::remove_cvref_t<Helpers>::DecayT...>::find(Element::name())};
+    if constexpr (std::is_reference_v<Type>) {
+      return named_init_value<Element>(std::forward<Helpers>(helpers)...);
+    } else if constexpr (index == sizeof...(Helpers)) {
+      return std::make_obj_using_allocator<Type>(alloc);
+    } else {
+      auto&& helper = std::get<index>(std::forward_as_tuple(std::forward<Helpers>(helpers)...));
+      using Helper = decltype(helper);
+      if constexpr (is_in_place_construct_v<decltype(std::remove_cvref_t<Helper>::value)>) {
+        return std::apply(
+            [&alloc]<typename... Args>(Args&&... args) {
+              return std::make_obj_using_allocator<Type>(alloc, std::forward<Args>(args)...);
+            },
+            std::move(helper.value.args));
+      } else {
+        return std::make_obj_using_allocator<Type>(alloc,
+                                                   forward_value(std::forward<Helper>(helper)));
+      }
+    }
+  }
+
+  template <typename Self, typename Visitor>
+  static constexpr bool visit_by_index_impl(Self& self, std::size_t index, Visitor& visitor) {
+    if constexpr (sizeof...(NamedTypes) == 0) {
+      return false;
+    } else {
+      if (index >= sizeof...(NamedTypes)) { return false; }
+      constexpr auto jump_table = []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        return std::array<void (*)(Self&, Visitor&), sizeof...(Indices)>{
+            [](Self& inner_self, Visitor& inner_visitor) {
+              std::invoke(inner_visitor, inner_self.template get<Indices>());
+            }...};
+      }(std::index_sequence_for<NamedTypes...>{});
+      jump_table[index](self, visitor);
+      return true;
+    }
+  }
+};
+
+#if defined(NAMED_TUPLE_ACCESS_COUNTERS)
+/**
+ * @brief Base template of helper template to get the access counters of a NamedTuple
+ * @tparam NT unconstrained type
+ */
+template <typename NT>
+struct AccessCountersOf;
+
+/**
+ * @brief Partially specialized helper template
+ * @tparam NamedTypes pack of NamedType of the NamedTuple
+ */
+template <typename... NamedTypes>
+struct AccessCountersOf<NamedTuple<NamedTypes...>> {
+  using type = AccessCounters<NamedTypes...>;
 };
+
+/**
+ * @brief Read the access counters of every element of a NamedTuple type
+ * @tparam NT type of NamedTuple
+ * @return the name and counts of every element in declared order
+ */
+template <typename NT>
+[[nodiscard]] auto access_counts() noexcept {
+  return AccessCountersOf<NT>::type::snapshot();
+}
+
+/**
+ * @brief Set the access counters of every element of a NamedTuple type to zero
+ * @tparam NT type of NamedTuple
+ */
+template <typename NT>
+void reset_access_counts() noexcept {
+  AccessCountersOf<NT>::type::reset();
+}
+#endif
 }  // namespace mguid
 
 // NOLINTBEGIN(cert-dcl58-cpp)
@@ -530,6 +1740,15 @@ template <typename... NamedTypes>
 struct tuple_size<mguid::NamedTuple<NamedTypes...>>
     : std::integral_constant<std::size_t, sizeof...(NamedTypes)> {};
 
+/**
+ * @brief Specialization of std::uses_allocator for NamedTuple, like std::tuple a NamedTuple
+ * accepts any allocator and passes it to the elements that use one
+ * @tparam NamedTypes type list for a NamedTuple
+ * @tparam Alloc type of allocator
+ */
+template <typename... NamedTypes, typename Alloc>
+struct uses_allocator<mguid::NamedTuple<NamedTypes...>, Alloc> : std::true_type {};
+
 /**
  * @brief Specialization of std::tuple_element for NamedTuple
  * @tparam Index index of tuple element in tuple
@@ -553,11 +1772,263 @@ namespace mguid {
  */
 template <typename... NamedTypeVs>
 [[nodiscard]] constexpr auto make_tuple(NamedTypeVs&&... args) {
-  return std::invoke(
-      []<typename... Types>(Types&&... inner_args) {
-        return NamedTuple<typename NamedTypeVs::DecayT...>{std::forward<Types>(inner_args)...};
-      },
-      std::forward<NamedTypeVs>(args).value...);
+  return NamedTuple<typename std::remove_cvref_t<NamedTypeVs>::DecayT...>{
+      forward_value(std::forward<NamedTypeVs>(args))...};
+}
+
+/**
+ * @brief Whether a type is a NamedTuple
+ * @tparam Type type to check
+ */
+template <typename Type>
+inline constexpr bool is_named_tuple_v{false};
+
+/**
+ * @brief Whether a type is a NamedTuple
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ */
+template <typename... NamedTypes>
+inline constexpr bool is_named_tuple_v<NamedTuple<NamedTypes...>>{true};
+
+/**
+ * @brief The position of an element of one of several NamedTuples
+ */
+struct ElementSource {
+  std::size_t tuple;
+  std::size_t element;
+};
+
+/**
+ * @brief Base template of helper template to concatenate the NamedType packs of NamedTuples
+ * @tparam NTs NamedTuple types
+ */
+template <typename... NTs>
+struct ConcatNamedTypes;
+
+/**
+ * @brief Specialization for no NamedTuples
+ */
+template <>
+struct ConcatNamedTypes<> {
+  using type = std::tuple<>;
+};
+
+/**
+ * @brief Partially specialized helper template, concatenates the first pack with the rest
+ * @tparam NamedTypes pack of NamedType of the first NamedTuple
+ * @tparam NTs remaining NamedTuple types
+ */
+template <typename... NamedTypes, typename... NTs>
+struct ConcatNamedTypes<NamedTuple<NamedTypes...>, NTs...> {
+  using type = decltype(std::tuple_cat(std::declval<std::tuple<NamedTypes...>>(),
+                                       std::declval<typename ConcatNamedTypes<NTs...>::type>()));
+};
+
+/**
+ * @brief Base template of helper template to make a NamedTuple from a std::tuple of NamedType
+ * @tparam Types unconstrained type
+ */
+template <typename Types>
+struct NamedTupleFrom;
+
+/**
+ * @brief Partially specialized helper template
+ * @tparam NamedTypes pack of NamedType
+ */
+template <typename... NamedTypes>
+struct NamedTupleFrom<std::tuple<NamedTypes...>> {
+  using type = NamedTuple<NamedTypes...>;
+};
+
+/**
+ * @brief Whether a std::tuple of NamedType types has unique tags
+ * @tparam Types unconstrained type
+ */
+template <typename Types>
+inline constexpr bool unique_pack_v{false};
+
+/**
+ * @brief Whether a std::tuple of NamedType types has unique tags
+ * @tparam NamedTypes pack of NamedType
+ */
+template <typename... NamedTypes>
+inline constexpr bool unique_pack_v<std::tuple<NamedTypes...>>{all_unique_v<NamedTypes...>};
+
+/**
+ * @brief Construct a NamedTuple from the elements of several NamedTuples at the given sources
+ * @tparam Result type of NamedTuple to construct
+ * @tparam Sources positions of the elements of Result within tuples
+ * @tparam Tuples types of NamedTuples
+ * @param tuples NamedTuples to take the elements from
+ * @return the constructed NamedTuple
+ */
+template <typename Result, auto Sources, typename... Tuples>
+[[nodiscard]] constexpr Result gather_elements(Tuples&&... tuples) {
+  auto references = std::forward_as_tuple(std::forward<Tuples>(tuples)...);
+  return [&references]<std::size_t... Positions>(std::index_sequence<Positions...>) {
+    return Result{std::get<Sources[Positions].tuple>(std::move(references))
+                      .template get<Sources[Positions].element>()...};
+  }(std::make_index_sequence<Sources.size()>{});
+}
+
+/**
+ * @brief Concatenate NamedTuples into one NamedTuple holding every element in order, the tags of
+ * all of the NamedTuples must be unique
+ *
+ * Elements of NamedTuples passed as rvalues are moved, all others are copied.
+ *
+ * @tparam Tuples types of NamedTuples
+ * @param tuples NamedTuples to concatenate
+ * @return a NamedTuple holding the elements of every NamedTuple in order
+ */
+template <typename... Tuples>
+  requires((is_named_tuple_v<std::remove_cvref_t<Tuples>> && ...) &&
+           unique_pack_v<typename ConcatNamedTypes<std::remove_cvref_t<Tuples>...>::type>)
+[[nodiscard]] constexpr auto concat(Tuples&&... tuples) {
+  using NamedTypes = typename ConcatNamedTypes<std::remove_cvref_t<Tuples>...>::type;
+  using Result = typename NamedTupleFrom<NamedTypes>::type;
+  constexpr auto kSources = [] {
+    constexpr std::array<std::size_t, sizeof...(Tuples)> kSizes{
+        std::tuple_size_v<std::remove_cvref_t<Tuples>>...};
+    std::array<ElementSource, std::tuple_size_v<Result>> result{};
+    std::size_t position{0};
+    for (std::size_t tuple{0}; tuple < kSizes.size(); ++tuple) {
+      for (std::size_t element{0}; element < kSizes[tuple]; ++element) {
+        result[position++] = ElementSource{tuple, element};
+      }
+    }
+    return result;
+  }();
+  return gather_elements<Result, kSources>(std::forward<Tuples>(tuples)...);
+}
+
+/**
+ * @brief Base template of helper template to merge the NamedType packs of two NamedTuples
+ * @tparam Lhs unconstrained type
+ * @tparam Rhs unconstrained type
+ */
+template <typename Lhs, typename Rhs>
+struct MergeNamedTypes;
+
+/**
+ * @brief Partially specialized helper template, every element of Lhs whose tag is also in Rhs is
+ * replaced by the element of Rhs, and the remaining elements of Rhs are appended
+ * @tparam LhsNamedTypes pack of NamedType of Lhs
+ * @tparam RhsNamedTypes pack of NamedType of Rhs
+ */
+template <typename... LhsNamedTypes, typename... RhsNamedTypes>
+struct MergeNamedTypes<NamedTuple<LhsNamedTypes...>, NamedTuple<RhsNamedTypes...>> {
+  static constexpr std::size_t overlap{
+      ((TagIndexTable<RhsNamedTypes...>::find(LhsNamedTypes::name()) != sizeof...(RhsNamedTypes)) +
+       ... + std::size_t{0})};
+
+  static constexpr auto sources = [] {
+    constexpr std::array<std::size_t, sizeof...(LhsNamedTypes)> kOverrides{
+        TagIndexTable<RhsNamedTypes...>::find(LhsNamedTypes::name())...};
+    constexpr std::array<bool, sizeof...(RhsNamedTypes)> kInLhs{
+        (TagIndexTable<LhsNamedTypes...>::find(RhsNamedTypes::name()) !=
+         sizeof...(LhsNamedTypes))...};
+    std::array<ElementSource, sizeof...(LhsNamedTypes) + sizeof...(RhsNamedTypes) - overlap>
+        result{};
+    std::size_t position{0};
+    for (std::size_t element{0}; element < kOverrides.size(); ++element) {
+      result[position++] = kOverrides[element] == sizeof...(RhsNamedTypes)
+                               ? ElementSource{0, element}
+                               : ElementSource{1, kOverrides[element]};
+    }
+    for (std::size_t element{0}; element < kInLhs.size(); ++element) {
+      if (!kInLhs[element]) { result[position++] = ElementSource{1, element}; }
+    }
+    return result;
+  }();
+
+  using type = typename decltype([]<std::size_t... Positions>(std::index_sequence<Positions...>) {
+    using Packs = std::tuple<std::tuple<LhsNamedTypes...>, std::tuple<RhsNamedTypes...>>;
+    return std::type_identity<NamedTuple<std::tuple_element_t<
+        sources[Positions].element, std::tuple_element_t<sources[Positions].tuple, Packs>>...>>{};
+  }(std::make_index_sequence<sources.size()>{}))::type;
+};
+
+/**
+ * @brief Merge two NamedTuples, elements whose tag is in both take the value and type of the
+ * element in rhs and keep the position of the element in lhs, the remaining elements of rhs are
+ * appended in order
+ *
+ * Elements of NamedTuples passed as rvalues are moved, all others are copied.
+ *
+ * @tparam Lhs type of first NamedTuple
+ * @tparam Rhs type of second NamedTuple, whose elements take precedence
+ * @param lhs first NamedTuple
+ * @param rhs second NamedTuple
+ * @return the merged NamedTuple
+ */
+template <typename Lhs, typename Rhs>
+  requires(is_named_tuple_v<std::remove_cvref_t<Lhs>> &&
+           is_named_tuple_v<std::remove_cvref_t<Rhs>>)
+[[nodiscard]] constexpr auto merge_with_override(Lhs&& lhs, Rhs&& rhs) {
+  using Merge = MergeNamedTypes<std::remove_cvref_t<Lhs>, std::remove_cvref_t<Rhs>>;
+  return gather_elements<typename Merge::type, Merge::sources>(std::forward<Lhs>(lhs),
+                                                               std::forward<Rhs>(rhs));
+}
+
+/**
+ * @brief Call a visitor with the NamedType and the value of every element of a NamedTuple in
+ * declared order, the NamedType argument gives access to the tag at compile time
+ * @tparam NT type of NamedTuple, possibly a reference
+ * @tparam Visitor type of visitor
+ * @param nt NamedTuple to visit
+ * @param visitor callable with a NamedType and a reference to an element
+ */
+template <typename NT, typename Visitor>
+  requires(is_named_tuple_v<std::remove_cvref_t<NT>>)
+constexpr void for_each(NT&& nt, Visitor&& visitor) {
+  [&nt, &visitor]<typename... NamedTypes, std::size_t... Indices>(
+      NamedTuple<NamedTypes...>*, std::index_sequence<Indices...>) {
+    (std::invoke(visitor, NamedTypes{}, std::forward<NT>(nt).template get<Indices>()), ...);
+  }(static_cast<std::remove_cvref_t<NT>*>(nullptr),
+    std::make_index_sequence<std::tuple_size_v<std::remove_cvref_t<NT>>>{});
+}
+
+/**
+ * @brief Call a function with every element of a NamedTuple as a NamedTypeValueHelper referring to
+ * the element, the helpers can be passed directly to the named constructor of another NamedTuple
+ * @tparam Function type of function
+ * @tparam NT type of NamedTuple, possibly a reference
+ * @param function callable with one NamedTypeValueHelper per element
+ * @param nt NamedTuple whose elements to pass
+ * @return the result of calling function
+ */
+template <typename Function, typename NT>
+  requires(is_named_tuple_v<std::remove_cvref_t<NT>>)
+constexpr decltype(auto) apply_named(Function&& function, NT&& nt) {
+  return [&nt, &function]<typename... NamedTypes, std::size_t... Indices>(
+             NamedTuple<NamedTypes...>*, std::index_sequence<Indices...>) -> decltype(auto) {
+    return std::invoke(
+        std::forward<Function>(function),
+        NamedTypeV<NamedTypes{}.tag()>(std::forward<NT>(nt).template get<Indices>())...);
+  }(static_cast<std::remove_cvref_t<NT>*>(nullptr),
+           std::make_index_sequence<std::tuple_size_v<std::remove_cvref_t<NT>>>{});
+}
+
+/**
+ * @brief Map every element of a NamedTuple into a new NamedTuple with the same tags
+ * @tparam NT type of NamedTuple, possibly a reference
+ * @tparam Function type of function
+ * @param nt NamedTuple whose elements to map
+ * @param function callable with a reference to any element
+ * @return a NamedTuple holding the result of function for every element under the same tag
+ */
+template <typename NT, typename Function>
+  requires(is_named_tuple_v<std::remove_cvref_t<NT>>)
+[[nodiscard]] constexpr auto transform(NT&& nt, Function&& function) {
+  return [&nt, &function]<typename... NamedTypes, std::size_t... Indices>(
+             NamedTuple<NamedTypes...>*, std::index_sequence<Indices...>) {
+    return NamedTuple<typename RebindType<
+        NamedTypes, std::invoke_result_t<Function&, decltype(std::forward<NT>(nt).template get<
+                                                                         Indices>())>>::type...>{
+        std::invoke(function, std::forward<NT>(nt).template get<Indices>())...};
+  }(static_cast<std::remove_cvref_t<NT>*>(nullptr),
+           std::make_index_sequence<std::tuple_size_v<std::remove_cvref_t<NT>>>{});
 }
 
 /**
@@ -569,9 +2040,9 @@ template <typename... NamedTypeVs>
  * @return A reference to the selected element of nt
  */
 template <StringLiteral Tag, typename... NamedTypes>
-  requires(sizeof...(NamedTypes) > 0 && is_one_of<Tag, NamedTypes{}...>())
+  requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
 [[nodiscard]] constexpr
-    typename std::tuple_element<key_index<Tag, NamedTypes{}...>(), NamedTuple<NamedTypes...>>::type&
+    typename std::tuple_element<key_index_v<Tag, NamedTypes...>, NamedTuple<NamedTypes...>>::type&
     get(NamedTuple<NamedTypes...>& nt) noexcept {
   return nt.template get<Tag>();
 }
@@ -585,11 +2056,11 @@ template <StringLiteral Tag, typename... NamedTypes>
  * @return A reference to the selected element of nt
  */
 template <StringLiteral Tag, typename... NamedTypes>
-  requires(sizeof...(NamedTypes) > 0 && is_one_of<Tag, NamedTypes{}...>())
-[[nodiscard]] constexpr typename std::tuple_element<key_index<Tag, NamedTypes{}...>(),
+  requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+[[nodiscard]] constexpr typename std::tuple_element<key_index_v<Tag, NamedTypes...>,
                                                     NamedTuple<NamedTypes...>>::type&&
 get(NamedTuple<NamedTypes...>&& nt) noexcept {
-  return nt.template get<Tag>();
+  return std::move(nt).template get<Tag>();
 }
 
 /**
@@ -601,8 +2072,8 @@ get(NamedTuple<NamedTypes...>&& nt) noexcept {
  * @return A reference to the selected element of nt
  */
 template <StringLiteral Tag, typename... NamedTypes>
-  requires(sizeof...(NamedTypes) > 0 && is_one_of<Tag, NamedTypes{}...>())
-[[nodiscard]] constexpr const typename std::tuple_element<key_index<Tag, NamedTypes{}...>(),
+  requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+[[nodiscard]] constexpr const typename std::tuple_element<key_index_v<Tag, NamedTypes...>,
                                                           NamedTuple<NamedTypes...>>::type&
 get(const NamedTuple<NamedTypes...>& nt) noexcept {
   return nt.template get<Tag>();
@@ -617,12 +2088,52 @@ get(const NamedTuple<NamedTypes...>& nt) noexcept {
  * @return A reference to the selected element of nt
  */
 template <StringLiteral Tag, typename... NamedTypes>
-  requires(sizeof...(NamedTypes) > 0 && is_one_of<Tag, NamedTypes{}...>())
-[[nodiscard]] constexpr const typename std::tuple_element<key_index<Tag, NamedTypes{}...>(),
+  requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+[[nodiscard]] constexpr const typename std::tuple_element<key_index_v<Tag, NamedTypes...>,
                                                           NamedTuple<NamedTypes...>>::type&&
 get(const NamedTuple<NamedTypes...>&& nt) noexcept {
-  return nt.template get<Tag>();
+  return std::move(nt).template get<Tag>();
 }
+
+/**
+ * @brief Base template of the schema hash of a NamedTuple
+ * @tparam NT unconstrained type
+ */
+template <typename NT>
+struct SchemaHash;
+
+/**
+ * @brief Compute a hash of the schema of a NamedTuple from the tag, type, size and alignment of
+ * every element in declared order
+ *
+ * Two NamedTuple types with the same schema hash can be assumed to have the same schema, so
+ * validating a record header written by another process is a single integer comparison. Elements
+ * of arithmetic, enumeration and array of those types hash the same with every compiler, while
+ * elements of other types are hashed by name and only match across builds with the same compiler.
+ *
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ */
+template <typename... NamedTypes>
+struct SchemaHash<NamedTuple<NamedTypes...>> {
+  static constexpr std::uint64_t value = [] {
+    std::uint64_t hash{mix64(sizeof...(NamedTypes))};
+    (
+        [&hash]<typename Type>(std::string_view tag) {
+          hash = mix64(hash ^ fnv1a_hash(tag));
+          hash = mix64(hash ^ type_hash<Type>());
+          hash = mix64(hash ^ (sizeof(Type) << 16U) ^ alignof(Type));
+        }.template operator()<typename ExtractType<NamedTypes>::type>(NamedTypes::name()),
+        ...);
+    return hash;
+  }();
+};
+
+/**
+ * @brief The schema hash of a NamedTuple
+ * @tparam NT a NamedTuple
+ */
+template <typename NT>
+inline constexpr std::uint64_t schema_hash_v{SchemaHash<NT>::value};
 }  // namespace mguid
 
 #endif  // MGUID_NAMEDTUPLE_H
@@ -0,0 +1,396 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+#ifndef MGUID_NAMEDTUPLEALGORITHMS_H
+#define MGUID_NAMEDTUPLEALGORITHMS_H
+
+#include "NamedTuple.hpp"
+#include "NamedTupleColumns.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(NAMED_TUPLE_USE_EXECUTION_POLICIES)
+#include <execution>
+#endif
+
+namespace mguid {
+
+/**
+ * @brief Number of elements from which the algorithms switch to parallel execution policies, only
+ * used when NAMED_TUPLE_USE_EXECUTION_POLICIES is defined
+ */
+inline constexpr std::size_t kParallelThreshold{std::size_t{1} << 15U};
+
+/**
+ * @brief The type of the element whose name is Tag in the elements of a range
+ * @tparam Tag the tag of the element
+ * @tparam Range type of range of NamedTuple like objects
+ */
+template <StringLiteral Tag, typename Range>
+using ProjectedT = std::remove_cvref_t<
+    decltype(std::declval<std::ranges::range_reference_t<Range>>().template get<Tag>())>;
+
+/**
+ * @brief Whether an algorithm over a range may use a parallel execution policy
+ * @tparam Range type of range
+ * @param range range the algorithm runs over
+ * @return true if parallel execution policies are enabled and the range is large enough
+ */
+template <typename Range>
+[[nodiscard]] constexpr bool use_parallel_policy([[maybe_unused]] Range&& range) noexcept {
+#if defined(NAMED_TUPLE_USE_EXECUTION_POLICIES)
+  if constexpr (std::ranges::random_access_range<Range> && std::ranges::sized_range<Range> &&
+                std::ranges::common_range<Range>) {
+    return std::ranges::size(range) >= kParallelThreshold;
+  }
+#endif
+  return false;
+}
+
+/**
+ * @brief A function object that orders NamedTuple like objects lexicographically by the elements
+ * named Tags, in the order the tags are given
+ * @tparam Tags tags of the elements to compare
+ */
+template <StringLiteral... Tags>
+  requires(sizeof...(Tags) > 0)
+struct LessBy {
+  /**
+   * @brief Compare two NamedTuple like objects
+   * @tparam Lhs type of left hand side
+   * @tparam Rhs type of right hand side
+   * @param lhs left hand side
+   * @param rhs right hand side
+   * @return true if lhs is ordered before rhs; otherwise false
+   */
+  template <typename Lhs, typename Rhs>
+  [[nodiscard]] constexpr bool operator()(const Lhs& lhs, const Rhs& rhs) const {
+    return compare_by<Tags...>(lhs, rhs) < 0;
+  }
+};
+
+/**
+ * @brief An instance of LessBy for the given tags
+ * @tparam Tags tags of the elements to compare
+ */
+template <StringLiteral... Tags>
+inline constexpr LessBy<Tags...> less_by{};
+
+/**
+ * @brief The type a sum of values of type Value is accumulated in, which is Value itself for types
+ * that are not arithmetic
+ * @tparam Value type of the summed values
+ */
+template <typename Value>
+struct SumValue {
+  using type = Value;
+};
+
+/**
+ * @brief Integers are summed in 64-bit integers of the same signedness
+ * @tparam Value integral type of the summed values
+ */
+template <typename Value>
+  requires(std::is_integral_v<Value>)
+struct SumValue<Value> {
+  using type = std::conditional_t<std::is_signed_v<Value>, std::int64_t, std::uint64_t>;
+};
+
+/**
+ * @brief Floating point values are summed in at least a double
+ * @tparam Value floating point type of the summed values
+ */
+template <typename Value>
+  requires(std::is_floating_point_v<Value>)
+struct SumValue<Value> {
+  using type = std::common_type_t<Value, double>;
+};
+
+/**
+ * @brief Helper alias for the type a sum of values of type Value is accumulated in
+ * @tparam Value type of the summed values
+ */
+template <typename Value>
+using SumValueT = typename SumValue<Value>::type;
+
+/**
+ * @brief Sum the values of a contiguous array with several independent accumulators, so the loop
+ * vectorizes even for floating point values
+ * @tparam Value type of value
+ * @param values values to sum
+ * @return the sum of values in SumValueT of Value
+ */
+template <typename Value>
+[[nodiscard]] constexpr SumValueT<Value> contiguous_sum(std::span<const Value> values) {
+  constexpr std::size_t kLanes{8};
+  std::array<SumValueT<Value>, kLanes> partial{};
+  std::size_t index{0};
+  for (; index + kLanes <= values.size(); index += kLanes) {
+    for (std::size_t lane{0}; lane < kLanes; ++lane) { partial[lane] += values[index + lane]; }
+  }
+  SumValueT<Value> total{};
+  for (const auto& value : partial) { total += value; }
+  for (; index < values.size(); ++index) { total += values[index]; }
+  return total;
+}
+
+/**
+ * @brief Sum the elements named Tag of every NamedTuple in a range
+ * @tparam Tag the tag of the element to sum
+ * @tparam Range type of range of NamedTuple like objects
+ * @param range range to sum over
+ * @return the sum of the elements named Tag in SumValueT of their type, or a value initialized
+ * value for an empty range
+ */
+template <StringLiteral Tag, std::ranges::input_range Range>
+[[nodiscard]] SumValueT<ProjectedT<Tag, Range>> sum(Range&& range) {
+  using Value = SumValueT<ProjectedT<Tag, Range>>;
+#if defined(NAMED_TUPLE_USE_EXECUTION_POLICIES)
+  if (use_parallel_policy(range)) {
+    return std::transform_reduce(std::execution::par_unseq, std::ranges::begin(range),
+                                 std::ranges::end(range), Value{}, std::plus<>{},
+                                 [](const auto& element) { return element.template get<Tag>(); });
+  }
+#endif
+  Value total{};
+  for (const auto& element : range) { total += element.template get<Tag>(); }
+  return total;
+}
+
+/**
+ * @brief Sum the column named Tag of a NamedTupleColumns
+ * @tparam Tag the tag of the column to sum
+ * @tparam NamedTypes pack of NamedType in the NamedTupleColumns
+ * @param columns container to sum over
+ * @return the sum of the column named Tag in SumValueT of its type, or a value initialized value
+ * for an empty container
+ */
+template <StringLiteral Tag, typename... NamedTypes>
+[[nodiscard]] auto sum(const NamedTupleColumns<NamedTypes...>& columns) {
+  const auto column = columns.template column<Tag>();
+#if defined(NAMED_TUPLE_USE_EXECUTION_POLICIES)
+  if (use_parallel_policy(column)) {
+    using Value = SumValueT<typename decltype(column)::value_type>;
+    return std::reduce(std::execution::par_unseq, column.begin(), column.end(), Value{});
+  }
+#endif
+  return contiguous_sum(column);
+}
+
+/**
+ * @brief Find the smallest and largest elements named Tag of every NamedTuple in a range
+ * @tparam Tag the tag of the element to compare
+ * @tparam Range type of range of NamedTuple like objects
+ * @param range range to search
+ * @return the smallest and largest values, or std::nullopt for an empty range
+ */
+template <StringLiteral Tag, std::ranges::input_range Range>
+[[nodiscard]] std::optional<std::ranges::minmax_result<ProjectedT<Tag, Range>>> min_max(
+    Range&& range) {
+  using Value = ProjectedT<Tag, Range>;
+  auto it = std::ranges::begin(range);
+  const auto end = std::ranges::end(range);
+  if (it == end) { return std::nullopt; }
+#if defined(NAMED_TUPLE_USE_EXECUTION_POLICIES)
+  if (use_parallel_policy(range)) {
+    const auto [min, max] = std::minmax_element(std::execution::par_unseq, it, end, less_by<Tag>);
+    return std::ranges::minmax_result<Value>{min->template get<Tag>(), max->template get<Tag>()};
+  }
+#endif
+  std::ranges::minmax_result<Value> result{(*it).template get<Tag>(), (*it).template get<Tag>()};
+  for (++it; it != end; ++it) {
+    const auto& value = (*it).template get<Tag>();
+    if (value < result.min) { result.min = value; }
+    if (result.max < value) { result.max = value; }
+  }
+  return result;
+}
+
+/**
+ * @brief Find the smallest and largest values of the column named Tag of a NamedTupleColumns
+ * @tparam Tag the tag of the column to compare
+ * @tparam NamedTypes pack of NamedType in the NamedTupleColumns
+ * @param columns container to search
+ * @return the smallest and largest values, or std::nullopt for an empty container
+ */
+template <StringLiteral Tag, typename... NamedTypes>
+[[nodiscard]] auto min_max(const NamedTupleColumns<NamedTypes...>& columns) {
+  const auto column = columns.template column<Tag>();
+  using Value = std::remove_cv_t<typename decltype(column)::element_type>;
+  std::optional<std::ranges::minmax_result<Value>> result{};
+  if (column.empty()) { return result; }
+  Value min{column.front()};
+  Value max{column.front()};
+  for (const auto& value : column) {
+    min = value < min ? value : min;
+    max = max < value ? value : max;
+  }
+  result.emplace(min, max);
+  return result;
+}
+
+/**
+ * @brief Copy every NamedTuple of a range whose element named Tag satisfies a predicate
+ * @tparam Tag the tag of the element to test
+ * @tparam Range type of range of NamedTuple like objects
+ * @tparam Predicate type of predicate
+ * @param range range to filter
+ * @param predicate predicate called with the element named Tag
+ * @return a vector holding copies of the selected NamedTuples in their original order
+ */
+template <StringLiteral Tag, std::ranges::input_range Range, typename Predicate>
+[[nodiscard]] std::vector<std::ranges::range_value_t<Range>> filter(Range&& range,
+                                                                    Predicate predicate) {
+  std::vector<std::ranges::range_value_t<Range>> result;
+  if constexpr (std::ranges::sized_range<Range>) { result.reserve(std::ranges::size(range)); }
+  for (auto&& element : range) {
+    if (std::invoke(predicate, std::as_const(element).template get<Tag>())) {
+      result.push_back(element);
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Copy every row of a NamedTupleColumns whose column named Tag satisfies a predicate
+ *
+ * The predicate is evaluated with a branchless scan over the contiguous column, and only the
+ * selected rows are gathered column by column into the result.
+ *
+ * @tparam Tag the tag of the column to test
+ * @tparam NamedTypes pack of NamedType in the NamedTupleColumns
+ * @tparam Predicate type of predicate
+ * @param columns container to filter
+ * @param predicate predicate called with each value of the column named Tag
+ * @return a container holding copies of the selected rows in their original order
+ */
+template <StringLiteral Tag, typename... NamedTypes, typename Predicate>
+[[nodiscard]] NamedTupleColumns<NamedTypes...> filter(
+    const NamedTupleColumns<NamedTypes...>& columns, Predicate predicate) {
+  const auto column = columns.template column<Tag>();
+  std::vector<std::size_t> selected(column.size());
+  std::size_t count{0};
+  for (std::size_t index{0}; index < column.size(); ++index) {
+    selected[count] = index;
+    count += static_cast<std::size_t>(static_cast<bool>(std::invoke(predicate, column[index])));
+  }
+  selected.resize(count);
+
+  NamedTupleColumns<NamedTypes...> result;
+  result.resize(selected.size());
+  [&columns, &result, &selected]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+    (std::ranges::transform(selected, result.template column<Indices>().begin(),
+                            [source = columns.template column<Indices>()](std::size_t index) {
+                              return source[index];
+                            }),
+     ...);
+  }(std::index_sequence_for<NamedTypes...>{});
+  return result;
+}
+
+/**
+ * @brief Sort a range of NamedTuple like objects lexicographically by the elements named Tags
+ *
+ * The sort is not stable.
+ *
+ * @tparam Tags tags of the elements to sort by, in order of significance
+ * @tparam Range type of range of NamedTuple like objects
+ * @param range range to sort
+ */
+template <StringLiteral... Tags, std::ranges::random_access_range Range>
+  requires(sizeof...(Tags) > 0 && std::sortable<std::ranges::iterator_t<Range>, LessBy<Tags...>>)
+void sort_by(Range&& range) {
+#if defined(NAMED_TUPLE_USE_EXECUTION_POLICIES)
+  if (use_parallel_policy(range)) {
+    std::sort(std::execution::par, std::ranges::begin(range), std::ranges::end(range),
+              less_by<Tags...>);
+    return;
+  }
+#endif
+  std::ranges::sort(range, less_by<Tags...>);
+}
+
+/**
+ * @brief Sort the rows of a NamedTupleColumns lexicographically by the columns named Tags
+ *
+ * The sort orders a permutation of row indices and then moves every column into place once, so
+ * each element is moved a constant number of times regardless of how many swaps the sort needs.
+ * The sort is not stable.
+ *
+ * @tparam Tags tags of the columns to sort by, in order of significance
+ * @tparam NamedTypes pack of NamedType in the NamedTupleColumns
+ * @param columns container to sort
+ */
+template <StringLiteral... Tags, typename... NamedTypes>
+  requires(sizeof...(Tags) > 0)
+void sort_by(NamedTupleColumns<NamedTypes...>& columns) {
+  std::vector<std::size_t> order(columns.size());
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  const auto& const_columns = columns;
+  const auto less = [&const_columns](std::size_t lhs, std::size_t rhs) {
+    return less_by<Tags...>(const_columns[lhs], const_columns[rhs]);
+  };
+#if defined(NAMED_TUPLE_USE_EXECUTION_POLICIES)
+  if (use_parallel_policy(order)) {
+    std::sort(std::execution::par, order.begin(), order.end(), less);
+  } else {
+    std::ranges::sort(order, less);
+  }
+#else
+  std::ranges::sort(order, less);
+#endif
+
+  [&columns, &order]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+    (
+        [&order](auto column) {
+          AlignedColumn<typename decltype(column)::value_type> sorted;
+          sorted.reserve(order.size());
+          for (const std::size_t index : order) { sorted.push_back(std::move(column[index])); }
+          std::ranges::move(sorted, column.begin());
+        }(columns.template column<Indices>()),
+        ...);
+  }(std::index_sequence_for<NamedTypes...>{});
+}
+}  // namespace mguid
+
+#endif  // MGUID_NAMEDTUPLEALGORITHMS_H
@@ -0,0 +1,415 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+
+#ifndef MGUID_NAMEDTUPLECOLUMNFILE_H
+#define MGUID_NAMEDTUPLECOLUMNFILE_H
+
+#include "NamedTupleColumns.hpp"
+#include "NamedTupleSerialization.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mguid {
+
+/**
+ * @brief Alignment of every column in a column file, and the size of its header
+ */
+inline constexpr std::size_t kColumnFilePageSize{4096};
+
+/**
+ * @brief Magic number at the beginning of every column file, "MGNTCOL1" in little endian order
+ */
+inline constexpr std::uint64_t kColumnFileMagic{0x314C4F43544E474DULL};
+
+/**
+ * @brief Base template of the layout of the header of a column file
+ * @tparam NT unconstrained type
+ */
+template <typename NT>
+struct ColumnFileLayout;
+
+/**
+ * @brief The layout of the header of a column file holding rows of a NamedTuple
+ *
+ * The header occupies the first page and holds the magic number, the fingerprint of the binary
+ * layout of a row, the number of rows and the number of columns, followed by the offset and the
+ * size in bytes of every column in declared order. Every column starts on a page boundary.
+ *
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ */
+template <typename... NamedTypes>
+  requires(TriviallySerializable<typename ExtractType<NamedTypes>::type> && ...)
+struct ColumnFileLayout<NamedTuple<NamedTypes...>> {
+  static constexpr std::size_t magic_offset{0};
+  static constexpr std::size_t fingerprint_offset{8};
+  static constexpr std::size_t rows_offset{16};
+  static constexpr std::size_t columns_offset{24};
+  static constexpr std::size_t directory_offset{32};
+  static constexpr std::size_t directory_entry_size{16};
+
+  static_assert(directory_offset + directory_entry_size * sizeof...(NamedTypes) <=
+                    kColumnFilePageSize,
+                "too many columns for the header of a column file");
+
+  static constexpr std::uint64_t fingerprint{BinaryLayout<NamedTuple<NamedTypes...>>::fingerprint};
+
+  static constexpr std::array<std::size_t, sizeof...(NamedTypes)> element_sizes{
+      sizeof(typename ExtractType<NamedTypes>::type)...};
+
+  /**
+   * @brief Round a size up to a whole number of pages
+   * @param size size in bytes
+   * @return the smallest multiple of kColumnFilePageSize not less than size
+   */
+  [[nodiscard]] static constexpr std::size_t round_to_page(std::size_t size) noexcept {
+    return (size + kColumnFilePageSize - 1) / kColumnFilePageSize * kColumnFilePageSize;
+  }
+};
+
+/**
+ * @brief Write the rows of a NamedTupleColumns to a column file, overwriting any existing file
+ * @tparam NamedTypes pack of NamedType in the NamedTupleColumns
+ * @param columns rows to write
+ * @param path path of the file to write
+ * @return true if the whole file was written; otherwise false
+ */
+template <typename... NamedTypes>
+  requires(TriviallySerializable<typename ExtractType<NamedTypes>::type> && ...)
+bool write_column_file(const NamedTupleColumns<NamedTypes...>& columns,
+                       const std::filesystem::path& path) {
+  using Layout = ColumnFileLayout<NamedTuple<NamedTypes...>>;
+  const std::unique_ptr<std::FILE, int (*)(std::FILE*)> file{
+      std::fopen(path.string().c_str(), "wb"), &std::fclose};
+  if (file == nullptr) { return false; }
+
+  const std::uint64_t rows{columns.size()};
+  const std::uint64_t column_count{sizeof...(NamedTypes)};
+  std::array<std::byte, kColumnFilePageSize> page{};
+  std::memcpy(page.data() + Layout::magic_offset, &kColumnFileMagic, sizeof(kColumnFileMagic));
+  std::memcpy(page.data() + Layout::fingerprint_offset, &Layout::fingerprint,
+              sizeof(Layout::fingerprint));
+  std::memcpy(page.data() + Layout::rows_offset, &rows, sizeof(rows));
+  std::memcpy(page.data() + Layout::columns_offset, &column_count, sizeof(column_count));
+
+  std::uint64_t offset{kColumnFilePageSize};
+  for (std::size_t index{0}; index < sizeof...(NamedTypes); ++index) {
+    const std::uint64_t size{rows * Layout::element_sizes[index]};
+    std::byte* entry =
+        page.data() + Layout::directory_offset + index * Layout::directory_entry_size;
+    std::memcpy(entry, &offset, sizeof(offset));
+    std::memcpy(entry + sizeof(offset), &size, sizeof(size));
+    offset += Layout::round_to_page(size);
+  }
+  if (std::fwrite(page.data(), 1, page.size(), file.get()) != page.size()) { return false; }
+
+  const std::array<std::byte, kColumnFilePageSize> padding{};
+  const auto write_column = [&file, &padding](const auto column) {
+    const std::size_t size{column.size_bytes()};
+    // an empty column has no storage, and fwrite must not be passed a null pointer
+    if (size == 0) { return true; }
+    const std::size_t padded{Layout::round_to_page(size)};
+    return std::fwrite(column.data(), 1, size, file.get()) == size &&
+           std::fwrite(padding.data(), 1, padded - size, file.get()) == padded - size;
+  };
+  const bool written = [&columns, &write_column]<std::size_t... Indices>(
+                           std::index_sequence<Indices...>) {
+    return (write_column(columns.template column<Indices>()) && ...);
+  }(std::index_sequence_for<NamedTypes...>{});
+  return written && std::fflush(file.get()) == 0;
+}
+
+/**
+ * @brief A read only mapping of a whole file into memory
+ *
+ * Files are mapped with mmap where it is available, so pages are only read from disk when they are
+ * first touched, otherwise the whole file is read into page aligned memory.
+ */
+class FileMapping {
+public:
+  /**
+   * @brief Map a file into memory
+   * @param path path of the file to map
+   * @return the mapping if the file could be opened and mapped; otherwise std::nullopt
+   */
+  [[nodiscard]] static std::optional<FileMapping> open(const std::filesystem::path& path) {
+#if __has_include(<sys/mman.h>)
+    const int fd{::open(path.c_str(), O_RDONLY)};
+    if (fd < 0) { return std::nullopt; }
+    struct stat status {};
+    void* address{MAP_FAILED};
+    if (::fstat(fd, &status) == 0 && status.st_size > 0) {
+      address = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_SHARED,
+                       fd, 0);
+    }
+    // the mapping keeps its own reference to the file
+    ::close(fd);
+    if (address == MAP_FAILED) { return std::nullopt; }
+    return FileMapping{static_cast<const std::byte*>(address),
+                       static_cast<std::size_t>(status.st_size)};
+#else
+    const std::unique_ptr<std::FILE, int (*)(std::FILE*)> file{
+        std::fopen(path.string().c_str(), "rb"), &std::fclose};
+    std::error_code error{};
+    const auto size = static_cast<std::size_t>(std::filesystem::file_size(path, error));
+    if (file == nullptr || error || size == 0) { return std::nullopt; }
+    FileMapping mapping{};
+    mapping.m_buffer.resize(size);
+    if (std::fread(mapping.m_buffer.data(), 1, size, file.get()) != size) { return std::nullopt; }
+    mapping.m_data = mapping.m_buffer.data();
+    mapping.m_size = size;
+    return mapping;
+#endif
+  }
+
+  FileMapping(const FileMapping&) = delete;
+  FileMapping& operator=(const FileMapping&) = delete;
+
+  /**
+   * @brief Move construct a mapping, leaving other empty
+   * @param other mapping to move from
+   */
+  FileMapping(FileMapping&& other) noexcept
+      : m_data{std::exchange(other.m_data, nullptr)},
+        m_size{std::exchange(other.m_size, 0)},
+        m_buffer{std::move(other.m_buffer)} {}
+
+  /**
+   * @brief Move assign a mapping, releasing the current one and leaving other empty
+   * @param other mapping to move from
+   * @return a reference to this mapping
+   */
+  FileMapping& operator=(FileMapping&& other) noexcept {
+    if (this != &other) {
+      release();
+      m_data = std::exchange(other.m_data, nullptr);
+      m_size = std::exchange(other.m_size, 0);
+      m_buffer = std::move(other.m_buffer);
+    }
+    return *this;
+  }
+
+  ~FileMapping() { release(); }
+
+  /**
+   * @brief Get the mapped bytes
+   * @return a span over the whole file
+   */
+  [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return {m_data, m_size}; }
+
+  /**
+   * @brief Hint that a range of the file will be read soon, so it can be read ahead
+   * @param offset offset of the first byte of the range
+   * @param size size of the range in bytes
+   */
+  void will_need([[maybe_unused]] std::size_t offset,
+                 [[maybe_unused]] std::size_t size) const noexcept {
+#if __has_include(<sys/mman.h>)
+    const std::size_t begin{offset / kColumnFilePageSize * kColumnFilePageSize};
+    if (m_data != nullptr && size > 0 && begin < m_size) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      ::madvise(const_cast<std::byte*>(m_data) + begin, std::min(size + offset, m_size) - begin,
+                MADV_WILLNEED);
+    }
+#endif
+  }
+
+private:
+  FileMapping() = default;
+  FileMapping(const std::byte* data, std::size_t size) noexcept : m_data{data}, m_size{size} {}
+
+  void release() noexcept {
+#if __has_include(<sys/mman.h>)
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    if (m_data != nullptr) { ::munmap(const_cast<std::byte*>(m_data), m_size); }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+  }
+
+  const std::byte* m_data{nullptr};
+  std::size_t m_size{0};
+  // holds the file contents when mmap is not available
+  std::vector<std::byte, AlignedAllocator<std::byte, kColumnFilePageSize>> m_buffer{};
+};
+
+/**
+ * @brief Base template of a memory mapped column file
+ * @tparam NT unconstrained type
+ */
+template <typename NT>
+class MappedColumnFile;
+
+/**
+ * @brief A column file written by write_column_file mapped into memory, every column is viewed in
+ * place without parsing and only the pages of the columns that are read are loaded from disk
+ * @tparam NamedTypes pack of NamedType in the NamedTuple whose rows the file holds
+ */
+template <typename... NamedTypes>
+  requires(TriviallySerializable<typename ExtractType<NamedTypes>::type> && ...)
+class MappedColumnFile<NamedTuple<NamedTypes...>> {
+  using NT = NamedTuple<NamedTypes...>;
+  using Layout = ColumnFileLayout<NT>;
+
+public:
+  using RowType = NT;
+
+  /**
+   * @brief Map a column file holding rows of type NT
+   * @param path path of the file to map
+   * @return the mapped file if it could be mapped and its header matches NT; otherwise std::nullopt
+   */
+  [[nodiscard]] static std::optional<MappedColumnFile> open(const std::filesystem::path& path) {
+    std::optional<FileMapping> mapping{FileMapping::open(path)};
+    if (!mapping.has_value()) { return std::nullopt; }
+    const std::span<const std::byte> bytes{mapping->bytes()};
+    if (bytes.size() < kColumnFilePageSize ||
+        read_word(bytes, Layout::magic_offset) != kColumnFileMagic ||
+        read_word(bytes, Layout::fingerprint_offset) != Layout::fingerprint ||
+        read_word(bytes, Layout::columns_offset) != sizeof...(NamedTypes)) {
+      return std::nullopt;
+    }
+
+    // every element takes at least one byte, which also keeps the sizes below from overflowing
+    const std::uint64_t rows{read_word(bytes, Layout::rows_offset)};
+    if (rows > bytes.size()) { return std::nullopt; }
+    std::array<std::size_t, sizeof...(NamedTypes)> offsets{};
+    for (std::size_t index{0}; index < sizeof...(NamedTypes); ++index) {
+      const std::size_t entry{Layout::directory_offset + index * Layout::directory_entry_size};
+      const std::uint64_t offset{read_word(bytes, entry)};
+      const std::uint64_t size{read_word(bytes, entry + sizeof(std::uint64_t))};
+      if (offset % kColumnFilePageSize != 0 || size != rows * Layout::element_sizes[index] ||
+          offset > bytes.size() || size > bytes.size() - offset) {
+        return std::nullopt;
+      }
+      offsets[index] = static_cast<std::size_t>(offset);
+    }
+    return MappedColumnFile{std::move(*mapping), static_cast<std::size_t>(rows), offsets};
+  }
+
+  /**
+   * @brief Get the number of rows in the file
+   * @return the number of rows in the file
+   */
+  [[nodiscard]] constexpr std::size_t size() const noexcept { return m_rows; }
+
+  /**
+   * @brief Check whether the file holds no rows
+   * @return true if the file holds no rows; otherwise false
+   */
+  [[nodiscard]] constexpr bool empty() const noexcept { return m_rows == 0; }
+
+  /**
+   * @brief Get the column at Index
+   * @tparam Index index of the column
+   * @return a span over the elements of the column inside the mapped file
+   */
+  template <std::size_t Index>
+    requires(Index < sizeof...(NamedTypes))
+  [[nodiscard]] auto column() const noexcept {
+    using Type = std::tuple_element_t<Index, NT>;
+    if (m_rows == 0) { return std::span<const Type>{}; }
+    // columns are page aligned and were written from objects of type Type
+    return std::span<const Type>{
+        reinterpret_cast<const Type*>(m_mapping.bytes().data() + m_offsets[Index]), m_rows};
+  }
+
+  /**
+   * @brief Get the column holding the elements whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @return a span over the elements of the column inside the mapped file
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] auto column() const noexcept {
+    return column<key_index_v<Tag, NamedTypes...>>();
+  }
+
+  /**
+   * @brief Hint that the column holding the elements whose name is Tag will be read soon
+   * @tparam Tag a StringLiteral to search for
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  void will_need() const noexcept {
+    constexpr std::size_t index{key_index_v<Tag, NamedTypes...>};
+    m_mapping.will_need(m_offsets[index], m_rows * Layout::element_sizes[index]);
+  }
+
+  /**
+   * @brief Copy the row at index into a NamedTuple
+   * @param index index of the row, must be less than size()
+   * @return a NamedTuple holding the elements of the row
+   */
+  [[nodiscard]] NT row(std::size_t index) const noexcept {
+    return [this, index]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+      return NT{column<Indices>()[index]...};
+    }(std::index_sequence_for<NamedTypes...>{});
+  }
+
+private:
+  MappedColumnFile(FileMapping&& mapping, std::size_t rows,
+                   const std::array<std::size_t, sizeof...(NamedTypes)>& offsets) noexcept
+      : m_mapping{std::move(mapping)}, m_rows{rows}, m_offsets{offsets} {}
+
+  [[nodiscard]] static std::uint64_t read_word(std::span<const std::byte> bytes,
+                                               std::size_t offset) noexcept {
+    std::uint64_t word{};
+    std::memcpy(&word, bytes.data() + offset, sizeof(word));
+    return word;
+  }
+
+  FileMapping m_mapping;
+  std::size_t m_rows;
+  std::array<std::size_t, sizeof...(NamedTypes)> m_offsets;
+};
+
+}  // namespace mguid
+
+#endif  // MGUID_NAMEDTUPLECOLUMNFILE_H
@@ -0,0 +1,469 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+#ifndef MGUID_NAMEDTUPLECOLUMNS_H
+#define MGUID_NAMEDTUPLECOLUMNS_H
+
+#include "NamedTuple.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mguid {
+
+/**
+ * @brief Allocator that hands out storage aligned to at least Alignment bytes
+ * @tparam Type type of element to allocate
+ * @tparam Alignment minimum alignment of every allocation
+ */
+template <typename Type, std::size_t Alignment = kCacheLineSize>
+struct AlignedAllocator {
+  static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+  using value_type = Type;
+
+  /**
+   * @brief Rebind this allocator to another element type, keeping the alignment
+   * @tparam Other the new element type
+   */
+  template <typename Other>
+  struct rebind {
+    using other = AlignedAllocator<Other, Alignment>;
+  };
+
+  constexpr AlignedAllocator() noexcept = default;
+
+  // NOLINTBEGIN(google-explicit-constructor)
+  /**
+   * @brief Converting constructor from an allocator of another element type
+   */
+  template <typename Other>
+  constexpr explicit(false) AlignedAllocator(const AlignedAllocator<Other, Alignment>&) noexcept {}
+  // NOLINTEND(google-explicit-constructor)
+
+  /**
+   * @brief Allocate aligned storage for count elements
+   * @param count number of elements to allocate storage for
+   * @return pointer to the uninitialized storage
+   */
+  [[nodiscard]] Type* allocate(std::size_t count) {
+    if (count > std::numeric_limits<std::size_t>::max() / sizeof(Type)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<Type*>(::operator new(count * sizeof(Type), std::align_val_t{kAlignment}));
+  }
+
+  /**
+   * @brief Release storage previously obtained from allocate
+   * @param ptr pointer returned by allocate
+   * @param count number of elements passed to allocate
+   */
+  void deallocate(Type* ptr, std::size_t count) noexcept {
+    ::operator delete(ptr, count * sizeof(Type), std::align_val_t{kAlignment});
+  }
+
+  /**
+   * @brief All AlignedAllocators with the same alignment are interchangeable
+   * @return true
+   */
+  template <typename Other>
+  [[nodiscard]] constexpr bool operator==(
+      const AlignedAllocator<Other, Alignment>&) const noexcept {
+    return true;
+  }
+
+private:
+  static constexpr std::size_t kAlignment{std::max(Alignment, alignof(Type))};
+};
+
+/**
+ * @brief Contiguous aligned storage for a single column of a NamedTupleColumns
+ * @tparam Type element type of the column
+ */
+template <typename Type>
+using AlignedColumn = std::vector<Type, AlignedAllocator<Type>>;
+
+/**
+ * @brief A structure-of-arrays container of rows described by the same NamedType pack as NamedTuple
+ *
+ * Every tag is stored in its own contiguous, cache line aligned array so that scanning a single
+ * field only touches memory belonging to that field.
+ *
+ * NOTE: bool columns are not supported since std::vector<bool> is not contiguous
+ *
+ * @tparam NamedTypes pack of NamedType types with unique names
+ */
+template <typename... NamedTypes>
+  requires(all_unique_v<NamedTypes...> &&
+           (std::is_object_v<typename ExtractType<NamedTypes>::type> && ...) &&
+           (!std::is_same_v<std::remove_cv_t<typename ExtractType<NamedTypes>::type>, bool> && ...))
+class NamedTupleColumns {
+  template <bool IsConst>
+  class BasicRow;
+
+public:
+  using RowType = NamedTuple<NamedTypes...>;
+  using Columns = std::tuple<AlignedColumn<typename ExtractType<NamedTypes>::type>...>;
+  using Row = BasicRow<false>;
+  using ConstRow = BasicRow<true>;
+
+  /**
+   * @brief Get the number of columns, one for each NamedType
+   * @return the number of columns
+   */
+  [[nodiscard]] static constexpr std::size_t column_count() { return sizeof...(NamedTypes); }
+
+  /**
+   * @brief Get the number of rows stored in this container
+   * @return the number of rows
+   */
+  [[nodiscard]] constexpr std::size_t size() const noexcept {
+    if constexpr (sizeof...(NamedTypes) == 0) {
+      return 0;
+    } else {
+      return std::get<0>(m_columns).size();
+    }
+  }
+
+  /**
+   * @brief Check whether this container holds no rows
+   * @return true if there are no rows; otherwise false
+   */
+  [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+  /**
+   * @brief Get the number of rows that can be held without reallocating any column
+   * @return the smallest capacity among all columns
+   */
+  [[nodiscard]] constexpr std::size_t capacity() const noexcept {
+    if constexpr (sizeof...(NamedTypes) == 0) {
+      return 0;
+    } else {
+      return std::apply(
+          [](const auto&... columns) { return std::min({columns.capacity()...}); }, m_columns);
+    }
+  }
+
+  /**
+   * @brief Reserve storage for at least count rows in every column
+   * @param count number of rows to reserve storage for
+   */
+  void reserve(std::size_t count) {
+    std::apply([count](auto&... columns) { (columns.reserve(count), ...); }, m_columns);
+  }
+
+  /**
+   * @brief Resize every column to count rows, value initializing new elements
+   * @param count new number of rows
+   */
+  void resize(std::size_t count) {
+    std::apply([count](auto&... columns) { (columns.resize(count), ...); }, m_columns);
+  }
+
+  /**
+   * @brief Remove all rows
+   */
+  void clear() noexcept {
+    std::apply([](auto&... columns) { (columns.clear(), ...); }, m_columns);
+  }
+
+  /**
+   * @brief Get the column holding the elements whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @return a span over the contiguous elements of the column
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] constexpr auto column() noexcept {
+    return column<key_index_v<Tag, NamedTypes...>>();
+  }
+
+  /**
+   * @brief Get the column holding the elements whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @return a span over the contiguous elements of the column
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] constexpr auto column() const noexcept {
+    return column<key_index_v<Tag, NamedTypes...>>();
+  }
+
+  /**
+   * @brief Get the column at Index
+   * @tparam Index index of the column
+   * @return a span over the contiguous elements of the column
+   */
+  template <std::size_t Index>
+    requires(Index < sizeof...(NamedTypes))
+  [[nodiscard]] constexpr auto column() noexcept {
+    return std::span<std::tuple_element_t<Index, typename RowType::Base>>{
+        std::get<Index>(m_columns)};
+  }
+
+  /**
+   * @brief Get the column at Index
+   * @tparam Index index of the column
+   * @return a span over the contiguous elements of the column
+   */
+  template <std::size_t Index>
+    requires(Index < sizeof...(NamedTypes))
+  [[nodiscard]] constexpr auto column() const noexcept {
+    return std::span<const std::tuple_element_t<Index, typename RowType::Base>>{
+        std::get<Index>(m_columns)};
+  }
+
+  /**
+   * @brief Get the underlying column vectors
+   * @return a const reference to the tuple of columns
+   */
+  [[nodiscard]] constexpr const Columns& columns() const noexcept { return m_columns; }
+
+  /**
+   * @brief Append a row, constructing each column element from the corresponding argument
+   *
+   * If constructing any element throws, the columns that already grew are shrunk again so all
+   * columns keep the same length.
+   *
+   * @tparam InitTypes types of initializer values
+   * @param init_values values to initialize each element of the new row, in declared order
+   * @return a proxy to the new row
+   */
+  template <typename... InitTypes>
+    requires(sizeof...(InitTypes) == sizeof...(NamedTypes))
+  Row emplace_back(InitTypes&&... init_values) {
+    emplace_back_impl(std::index_sequence_for<NamedTypes...>{},
+                      std::forward<InitTypes>(init_values)...);
+    return Row{this, size() - 1};
+  }
+
+  /**
+   * @brief Append a copy of a NamedTuple as a new row
+   * @param row the NamedTuple to copy from
+   */
+  void push_back(const RowType& row) {
+    std::apply([this](const auto&... elements) { emplace_back(elements...); },
+               static_cast<const typename RowType::Base&>(row));
+  }
+
+  /**
+   * @brief Append a NamedTuple as a new row, moving each of its elements
+   * @param row the NamedTuple to move from
+   */
+  void push_back(RowType&& row) {
+    std::apply([this](auto&&... elements) { emplace_back(std::move(elements)...); },
+               static_cast<typename RowType::Base&>(row));
+  }
+
+  /**
+   * @brief Remove the last row
+   */
+  void pop_back() {
+    std::apply([](auto&... columns) { (columns.pop_back(), ...); }, m_columns);
+  }
+
+  /**
+   * @brief Access the row at index without bounds checking
+   * @param index index of the row
+   * @return a proxy to the row
+   */
+  [[nodiscard]] Row operator[](std::size_t index) noexcept { return Row{this, index}; }
+
+  /**
+   * @brief Access the row at index without bounds checking
+   * @param index index of the row
+   * @return a proxy to the row
+   */
+  [[nodiscard]] ConstRow operator[](std::size_t index) const noexcept {
+    return ConstRow{this, index};
+  }
+
+  /**
+   * @brief Access the row at index
+   * @throws std::out_of_range if index is not less than size()
+   * @param index index of the row
+   * @return a proxy to the row
+   */
+  [[nodiscard]] Row at(std::size_t index) {
+    check_index(index);
+    return Row{this, index};
+  }
+
+  /**
+   * @brief Access the row at index
+   * @throws std::out_of_range if index is not less than size()
+   * @param index index of the row
+   * @return a proxy to the row
+   */
+  [[nodiscard]] ConstRow at(std::size_t index) const {
+    check_index(index);
+    return ConstRow{this, index};
+  }
+
+private:
+  template <std::size_t... Indices, typename... InitTypes>
+  void emplace_back_impl(std::index_sequence<Indices...>, InitTypes&&... init_values) {
+    std::size_t pushed{0};
+    try {
+      ((std::get<Indices>(m_columns).emplace_back(std::forward<InitTypes>(init_values)),
+        ++pushed),
+       ...);
+    } catch (...) {
+      ((Indices < pushed ? std::get<Indices>(m_columns).pop_back() : void()), ...);
+      throw;
+    }
+  }
+
+  void check_index(std::size_t index) const {
+    if (index >= size()) { throw std::out_of_range("NamedTupleColumns row index out of range"); }
+  }
+
+  /**
+   * @brief A reference to a single row of a NamedTupleColumns
+   * @tparam IsConst whether the referenced elements are const
+   */
+  template <bool IsConst>
+  class BasicRow {
+    using Container = std::conditional_t<IsConst, const NamedTupleColumns, NamedTupleColumns>;
+
+  public:
+    /**
+     * @brief Construct a row proxy referring to the row at index of container
+     * @param container container holding the row
+     * @param index index of the row
+     */
+    constexpr BasicRow(Container* container, std::size_t index) noexcept
+        : m_container{container}, m_index{index} {}
+
+    /**
+     * @brief Get the index of the referenced row
+     * @return the index of the referenced row
+     */
+    [[nodiscard]] constexpr std::size_t index() const noexcept { return m_index; }
+
+    /**
+     * @brief Get the number of elements in the referenced row
+     * @return the number of elements in the referenced row
+     */
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return sizeof...(NamedTypes); }
+
+    /**
+     * @brief Extracts the element of the row whose name is Tag
+     * @tparam Tag a StringLiteral to search for
+     * @return the element of the row whose name is Tag
+     */
+    template <StringLiteral Tag>
+      requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+    [[nodiscard]] constexpr auto& get() const noexcept {
+      return m_container->template column<Tag>()[m_index];
+    }
+
+    /**
+     * @brief Extracts the element of the row whose index is Index
+     * @tparam Index index of the element to get
+     * @return the element of the row whose index is Index
+     */
+    template <std::size_t Index>
+      requires(Index < sizeof...(NamedTypes))
+    [[nodiscard]] constexpr auto& get() const noexcept {
+      return m_container->template column<Index>()[m_index];
+    }
+
+    /**
+     * @brief Set the element of the row with the name Tag to value
+     * @tparam Tag StringLiteral element name
+     * @tparam Value type of value, convertible to the type of the element associated with Tag
+     * @param value value to set
+     */
+    template <StringLiteral Tag, typename Value>
+      requires(!IsConst && sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...> &&
+               std::is_convertible_v<Value, std::tuple_element_t<key_index_v<Tag, NamedTypes...>,
+                                                                 typename RowType::Base>>)
+    constexpr void set(Value&& value) const {
+      get<Tag>() = std::forward<Value>(value);
+    }
+
+    /**
+     * @brief Copy the referenced row into a NamedTuple
+     * @return a NamedTuple holding a copy of every element of the row
+     */
+    [[nodiscard]] constexpr RowType to_tuple() const {
+      return to_tuple_impl(std::index_sequence_for<NamedTypes...>{});
+    }
+
+    // NOLINTBEGIN(google-explicit-constructor)
+    /**
+     * @brief Implicit conversion to a NamedTuple holding a copy of the referenced row
+     * @return a NamedTuple holding a copy of every element of the row
+     */
+    [[nodiscard]] constexpr explicit(false) operator RowType() const { return to_tuple(); }
+    // NOLINTEND(google-explicit-constructor)
+
+    /**
+     * @brief Overwrite every element of the referenced row with the elements of a NamedTuple
+     * @param row the NamedTuple to copy from
+     * @return this row proxy
+     */
+    const BasicRow& operator=(const RowType& row) const
+      requires(!IsConst)
+    {
+      assign_impl(std::index_sequence_for<NamedTypes...>{}, row);
+      return *this;
+    }
+
+  private:
+    template <std::size_t... Indices>
+    constexpr RowType to_tuple_impl(std::index_sequence<Indices...>) const {
+      return RowType{get<Indices>()...};
+    }
+
+    template <std::size_t... Indices>
+    constexpr void assign_impl(std::index_sequence<Indices...>, const RowType& row) const {
+      ((get<Indices>() = row.template get<Indices>()), ...);
+    }
+
+    Container* m_container;
+    std::size_t m_index;
+  };
+
+  Columns m_columns;
+};
+}  // namespace mguid
+
+#endif  // MGUID_NAMEDTUPLECOLUMNS_H
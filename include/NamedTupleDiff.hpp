@@ -0,0 +1,310 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+
+#ifndef MGUID_NAMEDTUPLEDIFF_H
+#define MGUID_NAMEDTUPLEDIFF_H
+
+#include "NamedTupleSerialization.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace mguid {
+
+/**
+ * @brief A set of element indices of a NamedTuple, stored one bit per element
+ * @tparam Count number of elements in the NamedTuple
+ */
+template <std::size_t Count>
+class FieldMask {
+public:
+  using Word = BitmapWord<Count>;
+
+  static constexpr std::size_t kWordBits{sizeof(Word) * 8};
+  static constexpr std::size_t kWordCount{(Count + kWordBits - 1) / kWordBits};
+
+  using Words = std::array<Word, kWordCount>;
+
+  /**
+   * @brief Construct an empty FieldMask
+   */
+  constexpr FieldMask() = default;
+
+  /**
+   * @brief Construct a FieldMask from its words, bits past Count are cleared
+   * @param words words of the mask, bit i of the mask is bit i % kWordBits of word i / kWordBits
+   */
+  constexpr explicit FieldMask(const Words& words) noexcept : m_words{words} {
+    if constexpr (kWordCount > 0 && Count % kWordBits != 0) {
+      m_words.back() &= static_cast<Word>((Word{1} << (Count % kWordBits)) - 1);
+    }
+  }
+
+  /**
+   * @brief Get the number of elements this FieldMask can hold
+   * @return Count
+   */
+  [[nodiscard]] static constexpr std::size_t size() noexcept { return Count; }
+
+  /**
+   * @brief Check whether the element at index is in this FieldMask
+   * @param index index of the element, less than Count
+   * @return true if the element is in this FieldMask; otherwise false
+   */
+  [[nodiscard]] constexpr bool test(std::size_t index) const noexcept {
+    return ((m_words[index / kWordBits] >> (index % kWordBits)) & Word{1}) != 0;
+  }
+
+  /**
+   * @brief Add the element at index to this FieldMask
+   * @param index index of the element, less than Count
+   * @return a reference to this
+   */
+  constexpr FieldMask& set(std::size_t index) noexcept {
+    m_words[index / kWordBits] |= static_cast<Word>(Word{1} << (index % kWordBits));
+    return *this;
+  }
+
+  /**
+   * @brief Remove the element at index from this FieldMask
+   * @param index index of the element, less than Count
+   * @return a reference to this
+   */
+  constexpr FieldMask& reset(std::size_t index) noexcept {
+    m_words[index / kWordBits] &= static_cast<Word>(~(Word{1} << (index % kWordBits)));
+    return *this;
+  }
+
+  /**
+   * @brief Count the elements in this FieldMask with one popcount per word
+   * @return the number of elements in this FieldMask
+   */
+  [[nodiscard]] constexpr std::size_t count() const noexcept {
+    std::size_t count{0};
+    for (const auto word : m_words) { count += static_cast<std::size_t>(std::popcount(word)); }
+    return count;
+  }
+
+  /**
+   * @brief Check whether this FieldMask is empty
+   * @return true if no element is in this FieldMask; otherwise false
+   */
+  [[nodiscard]] constexpr bool none() const noexcept { return m_words == Words{}; }
+
+  /**
+   * @brief Check whether this FieldMask is not empty
+   * @return true if any element is in this FieldMask; otherwise false
+   */
+  [[nodiscard]] constexpr bool any() const noexcept { return !none(); }
+
+  /**
+   * @brief Get the words of this FieldMask
+   * @return a const reference to the words of this FieldMask
+   */
+  [[nodiscard]] constexpr const Words& words() const noexcept { return m_words; }
+
+  /**
+   * @brief Add every element of other to this FieldMask, e.g. to coalesce consecutive diffs
+   * @param other FieldMask to merge into this
+   * @return a reference to this
+   */
+  constexpr FieldMask& operator|=(const FieldMask& other) noexcept {
+    for (std::size_t index{0}; index < kWordCount; ++index) {
+      m_words[index] |= other.m_words[index];
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Get the union of two FieldMask
+   * @param lhs first FieldMask
+   * @param rhs second FieldMask
+   * @return a FieldMask holding the elements of both
+   */
+  [[nodiscard]] friend constexpr FieldMask operator|(FieldMask lhs, const FieldMask& rhs) noexcept {
+    return lhs |= rhs;
+  }
+
+  [[nodiscard]] constexpr bool operator==(const FieldMask&) const = default;
+
+private:
+  Words m_words{};
+};
+
+/**
+ * @brief Helper variable template for the FieldMask type of a NamedTuple
+ * @tparam NT a NamedTuple type
+ */
+template <typename NT>
+using FieldMaskFor = FieldMask<std::tuple_size_v<NT>>;
+
+/**
+ * @brief Compute the elements that differ between two NamedTuple
+ *
+ * Records that compare equal with operator==, a single memcmp for tuples without padding, return
+ * an empty mask right away; otherwise the elements are compared tag by tag.
+ *
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ * @param from the old record
+ * @param to the new record
+ * @return a FieldMask holding the index of every element that is not equal in from and to
+ */
+template <typename... NamedTypes>
+[[nodiscard]] constexpr FieldMask<sizeof...(NamedTypes)> diff(
+    const NamedTuple<NamedTypes...>& from, const NamedTuple<NamedTypes...>& to) {
+  FieldMask<sizeof...(NamedTypes)> mask{};
+  if constexpr (byte_comparable_v<NamedTuple<NamedTypes...>,
+                                  typename ExtractType<NamedTypes>::type...>) {
+    if (from == to) { return mask; }
+  }
+  [&from, &to, &mask]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+    ((from.template get<NamedTypes{}.tag()>() == to.template get<NamedTypes{}.tag()>()
+          ? void()
+          : void(mask.set(Indices))),
+     ...);
+  }(std::index_sequence_for<NamedTypes...>{});
+  return mask;
+}
+
+/**
+ * @brief Copy the elements in mask from source into nt
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ * @param nt NamedTuple to update
+ * @param mask elements to copy, usually the result of diff
+ * @param source NamedTuple to copy the elements from
+ */
+template <typename... NamedTypes>
+constexpr void apply_patch(NamedTuple<NamedTypes...>& nt,
+                           const FieldMask<sizeof...(NamedTypes)>& mask,
+                           const NamedTuple<NamedTypes...>& source) {
+  [&nt, &mask, &source]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+    ((mask.test(Indices) ? nt.template set<NamedTypes{}.tag()>(
+                               source.template get<NamedTypes{}.tag()>())
+                         : void()),
+     ...);
+  }(std::index_sequence_for<NamedTypes...>{});
+}
+
+/**
+ * @brief Get the number of bytes a patch of the elements in mask is serialized to
+ * @tparam NT a NamedTuple whose elements are all trivially copyable
+ * @param mask elements in the patch
+ * @return the sum of the sizes of the elements in mask
+ */
+template <BinarySerializable NT>
+  requires(is_named_tuple_v<NT>)
+[[nodiscard]] constexpr std::size_t patch_size(const FieldMaskFor<NT>& mask) noexcept {
+  constexpr auto kSizes = []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+    return std::array<std::size_t, sizeof...(Indices)>{
+        sizeof(std::tuple_element_t<Indices, typename NT::Base>)...};
+  }(std::make_index_sequence<std::tuple_size_v<NT>>{});
+  std::size_t size{0};
+  for (std::size_t index{0}; index < kSizes.size(); ++index) {
+    if (mask.test(index)) { size += kSizes[index]; }
+  }
+  return size;
+}
+
+/**
+ * @brief Serialize the elements of nt in mask into a buffer
+ *
+ * The elements are written in declared order with no padding and no header. The receiver needs the
+ * same mask and schema to apply the patch, so send the mask words alongside the payload and check
+ * the schema once per stream, e.g. with the fingerprint of BinaryLayout.
+ *
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ * @param nt NamedTuple holding the new values
+ * @param mask elements to write, usually the result of diff
+ * @param buffer buffer to write into, at least patch_size(mask) bytes long
+ * @return the number of bytes written, or 0 if the buffer is too small
+ */
+template <typename... NamedTypes>
+  requires(TriviallySerializable<typename ExtractType<NamedTypes>::type> && ...)
+std::size_t serialize_patch(const NamedTuple<NamedTypes...>& nt,
+                            const FieldMask<sizeof...(NamedTypes)>& mask,
+                            std::span<std::byte> buffer) noexcept {
+  if (buffer.size() < patch_size<NamedTuple<NamedTypes...>>(mask)) { return 0; }
+
+  std::size_t offset{0};
+  [&nt, &mask, &buffer, &offset]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+    ([&nt, &mask, &buffer, &offset]<std::size_t Index>() {
+      if (!mask.test(Index)) { return; }
+      const auto& value = nt.template get<Index>();
+      std::memcpy(buffer.data() + offset, &value, sizeof(value));
+      offset += sizeof(value);
+    }.template operator()<Indices>(),
+     ...);
+  }(std::index_sequence_for<NamedTypes...>{});
+  return offset;
+}
+
+/**
+ * @brief Write the elements in mask from a payload written by serialize_patch into nt
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ * @param nt NamedTuple to update through set
+ * @param mask elements in the payload
+ * @param payload buffer holding the elements in mask, written by serialize_patch
+ * @return true if the payload was large enough to hold the elements in mask; otherwise false and nt
+ * is left unchanged
+ */
+template <typename... NamedTypes>
+  requires(TriviallySerializable<typename ExtractType<NamedTypes>::type> && ...)
+bool apply_patch(NamedTuple<NamedTypes...>& nt, const FieldMask<sizeof...(NamedTypes)>& mask,
+                 std::span<const std::byte> payload) noexcept {
+  if (payload.size() < patch_size<NamedTuple<NamedTypes...>>(mask)) { return false; }
+
+  std::size_t offset{0};
+  [&nt, &mask, &payload, &offset]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+    ([&nt, &mask, &payload, &offset]<std::size_t Index>() {
+      if (!mask.test(Index)) { return; }
+      using Element = std::tuple_element_t<Index, typename NamedTuple<NamedTypes...>::Base>;
+      // read through bytes, since the element need not be default constructible
+      std::array<std::byte, sizeof(Element)> bytes;
+      std::memcpy(bytes.data(), payload.data() + offset, bytes.size());
+      nt.template set<std::tuple_element_t<Index, std::tuple<NamedTypes...>>{}.tag()>(
+          std::bit_cast<Element>(bytes));
+      offset += sizeof(Element);
+    }.template operator()<Indices>(),
+     ...);
+  }(std::index_sequence_for<NamedTypes...>{});
+  return true;
+}
+
+}  // namespace mguid
+
+#endif  // MGUID_NAMEDTUPLEDIFF_H
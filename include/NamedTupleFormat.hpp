@@ -0,0 +1,202 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+
+#ifndef MGUID_NAMEDTUPLEFORMAT_H
+#define MGUID_NAMEDTUPLEFORMAT_H
+
+#include "NamedTuple.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <version>
+
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+
+#if defined(NAMED_TUPLE_USE_FMT)
+#include <fmt/format.h>
+#endif
+
+namespace mguid {
+
+/**
+ * @brief The text written before the value of an element, the opening brace or a separator
+ * followed by the name of the element and an equals sign, joined at compile time
+ * @tparam Tag tag of the element
+ * @tparam First true if the element is the first element of the tuple
+ */
+template <StringLiteral Tag, bool First>
+inline constexpr auto kFormatFieldPrefix = [] {
+  constexpr std::string_view name{Tag.value, Tag.size - 1};
+  constexpr std::string_view separator{First ? "{" : ", "};
+  std::array<char, separator.size() + name.size() + 1> result{};
+  auto output = std::copy(separator.begin(), separator.end(), result.begin());
+  output = std::copy(name.begin(), name.end(), output);
+  *output = '=';
+  return result;
+}();
+
+/**
+ * @brief Base template of a formatter of a NamedTuple shared by std::format and {fmt}
+ * @tparam Formatter formatter template of the formatting library
+ * @tparam ParseContext parse context of the formatting library
+ * @tparam FormatError exception type of the formatting library
+ * @tparam NT unconstrained type
+ */
+template <template <typename...> class Formatter, typename ParseContext, typename FormatError,
+          typename NT>
+class BasicNamedTupleFormatter;
+
+/**
+ * @brief Formats a NamedTuple as {name=value, ...}
+ *
+ * The format spec is a list of name=spec separated by semicolons, where spec is passed to the
+ * formatter of the element called name, e.g. "{:price=.2f;qty=>6}". Elements without a spec are
+ * formatted with an empty spec. Specs may not contain semicolons or nested replacement fields.
+ *
+ * @tparam Formatter formatter template of the formatting library
+ * @tparam ParseContext parse context of the formatting library
+ * @tparam FormatError exception type of the formatting library
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ */
+template <template <typename...> class Formatter, typename ParseContext, typename FormatError,
+          typename... NamedTypes>
+class BasicNamedTupleFormatter<Formatter, ParseContext, FormatError, NamedTuple<NamedTypes...>> {
+  using NT = NamedTuple<NamedTypes...>;
+
+public:
+  /**
+   * @brief Parse the format spec of a NamedTuple
+   * @tparam Context type of parse context
+   * @param ctx parse context positioned at the format spec
+   * @return an iterator to the end of the format spec
+   */
+  template <typename Context>
+  constexpr auto parse(Context& ctx) -> decltype(ctx.begin()) {
+    [this]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+      (parse_element<Indices>(std::string_view{}), ...);
+    }(std::index_sequence_for<NamedTypes...>{});
+
+    auto it = ctx.begin();
+    const auto end = ctx.end();
+    while (it != end && *it != '}') {
+      const auto name_end = std::find(it, end, '=');
+      if (name_end == end) { throw FormatError("expected name=spec in NamedTuple format spec"); }
+      const auto spec_end =
+          std::find_if(name_end, end, [](char c) { return c == ';' || c == '}'; });
+
+      const std::optional<std::size_t> index = NT::index_of(std::string_view{it, name_end});
+      if (!index.has_value()) { throw FormatError("unknown name in NamedTuple format spec"); }
+      [this, &index, spec = std::string_view{name_end + 1, spec_end}]<std::size_t... Indices>(
+          std::index_sequence<Indices...>) {
+        ((*index == Indices ? parse_element<Indices>(spec) : void()), ...);
+      }(std::index_sequence_for<NamedTypes...>{});
+
+      it = spec_end;
+      if (it != end && *it == ';') { ++it; }
+    }
+    return it;
+  }
+
+  /**
+   * @brief Format a NamedTuple
+   * @tparam Context type of format context
+   * @param nt NamedTuple to format
+   * @param ctx format context to write to
+   * @return an iterator past the last written character
+   */
+  template <typename Context>
+  auto format(const NT& nt, Context& ctx) const -> decltype(ctx.out()) {
+    auto out = ctx.out();
+    if constexpr (sizeof...(NamedTypes) == 0) {
+      *out++ = '{';
+    } else {
+      [this, &nt, &ctx, &out]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        ((out = std::copy(kFormatFieldPrefix<NamedTypes{}.tag(), Indices == 0>.begin(),
+                          kFormatFieldPrefix<NamedTypes{}.tag(), Indices == 0>.end(), out),
+          ctx.advance_to(out),
+          out = std::get<Indices>(m_formatters).format(nt.template get<Indices>(), ctx)),
+         ...);
+      }(std::index_sequence_for<NamedTypes...>{});
+    }
+    *out++ = '}';
+    return out;
+  }
+
+private:
+  template <std::size_t Index>
+  constexpr void parse_element(std::string_view spec) {
+    ParseContext element_ctx{spec};
+    if (std::get<Index>(m_formatters).parse(element_ctx) != element_ctx.end()) {
+      throw FormatError("invalid element spec in NamedTuple format spec");
+    }
+  }
+
+  std::tuple<Formatter<typename ExtractType<NamedTypes>::type, char>...> m_formatters{};
+};
+}  // namespace mguid
+
+#if defined(__cpp_lib_format)
+// NOLINTBEGIN(cert-dcl58-cpp)
+namespace std {
+/**
+ * @brief Specialization of std::formatter for NamedTuple
+ * @tparam NamedTypes type list for a NamedTuple
+ */
+template <typename... NamedTypes>
+struct formatter<mguid::NamedTuple<NamedTypes...>, char>
+    : mguid::BasicNamedTupleFormatter<formatter, basic_format_parse_context<char>, format_error,
+                                      mguid::NamedTuple<NamedTypes...>> {};
+}  // namespace std
+// NOLINTEND(cert-dcl58-cpp)
+#endif
+
+#if defined(NAMED_TUPLE_USE_FMT)
+namespace fmt {
+/**
+ * @brief Specialization of fmt::formatter for NamedTuple
+ * @tparam NamedTypes type list for a NamedTuple
+ */
+template <typename... NamedTypes>
+struct formatter<mguid::NamedTuple<NamedTypes...>, char>
+    : mguid::BasicNamedTupleFormatter<formatter, basic_format_parse_context<char>, format_error,
+                                      mguid::NamedTuple<NamedTypes...>> {};
+}  // namespace fmt
+#endif
+
+#endif  // MGUID_NAMEDTUPLEFORMAT_H
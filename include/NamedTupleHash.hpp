@@ -0,0 +1,265 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+#ifndef MGUID_NAMEDTUPLEHASH_H
+#define MGUID_NAMEDTUPLEHASH_H
+
+#include "NamedTuple.hpp"
+#include "PackedNamedTuple.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace mguid {
+
+/**
+ * @brief Multiply two 64-bit integers and fold the 128-bit product into 64 bits, this is the
+ * mixing step of wyhash
+ * @param lhs first factor
+ * @param rhs second factor
+ * @return the high half of the product xor the low half
+ */
+[[nodiscard]] constexpr std::uint64_t mum(std::uint64_t lhs, std::uint64_t rhs) noexcept {
+#if defined(__SIZEOF_INT128__)
+  __extension__ using Uint128 = unsigned __int128;
+  const auto product = static_cast<Uint128>(lhs) * rhs;
+  return static_cast<std::uint64_t>(product >> 64U) ^ static_cast<std::uint64_t>(product);
+#else
+  const std::uint64_t lhs_high{lhs >> 32U};
+  const std::uint64_t lhs_low{lhs & 0xffffffffULL};
+  const std::uint64_t rhs_high{rhs >> 32U};
+  const std::uint64_t rhs_low{rhs & 0xffffffffULL};
+  const std::uint64_t high_high{lhs_high * rhs_high};
+  const std::uint64_t high_low{lhs_high * rhs_low};
+  const std::uint64_t low_high{lhs_low * rhs_high};
+  const std::uint64_t low_low{lhs_low * rhs_low};
+  const std::uint64_t cross{(low_low >> 32U) + (high_low & 0xffffffffULL) + low_high};
+  const std::uint64_t high{high_high + (high_low >> 32U) + (cross >> 32U)};
+  const std::uint64_t low{(cross << 32U) | (low_low & 0xffffffffULL)};
+  return high ^ low;
+#endif
+}
+
+/**
+ * @brief Combine a hash into a running seed
+ * @param seed running seed
+ * @param hash hash to combine
+ * @return the combined seed
+ */
+[[nodiscard]] constexpr std::uint64_t hash_combine(std::uint64_t seed,
+                                                  std::uint64_t hash) noexcept {
+  return mum(seed ^ hash, 0x9e3779b97f4a7c15ULL);
+}
+
+/**
+ * @brief Hash a buffer of bytes in a single pass, eight bytes at a time with wyhash style mixing
+ * @param data pointer to the first byte
+ * @param size number of bytes
+ * @return the hash of the bytes
+ */
+[[nodiscard]] inline std::uint64_t hash_bytes(const std::byte* data, std::size_t size) noexcept {
+  constexpr std::uint64_t kSecret0{0xa0761d6478bd642fULL};
+  constexpr std::uint64_t kSecret1{0xe7037ed1a0b428dbULL};
+  std::uint64_t seed{kSecret0 ^ size};
+  std::size_t offset{0};
+  for (; offset + sizeof(std::uint64_t) <= size; offset += sizeof(std::uint64_t)) {
+    std::uint64_t word{};
+    std::memcpy(&word, data + offset, sizeof(word));
+    seed = mum(seed ^ word, kSecret1);
+  }
+  if (offset < size) {
+    std::uint64_t word{};
+    std::memcpy(&word, data + offset, size - offset);
+    seed = mum(seed ^ word, kSecret1);
+  }
+  return mum(seed, kSecret0 ^ size);
+}
+
+/**
+ * @brief Whether an object holding elements of types Types can be hashed by hashing its bytes,
+ * which requires the object to be byte comparable, so that equal objects have equal bytes even
+ * when an element type specializes std::hash and operator== itself
+ * @tparam Object type of object holding the elements
+ * @tparam Types types of the elements
+ */
+template <typename Object, typename... Types>
+inline constexpr bool byte_hashable_v{byte_comparable_v<Object, Types...>};
+
+/**
+ * @brief Whether a type can be hashed with std::hash
+ * @tparam Type type to check
+ */
+template <typename Type>
+concept StdHashable = requires(const Type& value) {
+  { std::hash<Type>{}(value) } -> std::convertible_to<std::size_t>;
+};
+
+/**
+ * @brief A transparent hash function object over the elements named Tags of any NamedTuple like
+ * object, so that an unordered container keyed by a wide record can be searched with any object
+ * holding just the key elements
+ *
+ * Objects that compare equal with EqualBy must hash their elements to the same value, as
+ * std::string and std::string_view do.
+ *
+ * @tparam Tags tags of the elements to hash
+ */
+template <StringLiteral... Tags>
+  requires(sizeof...(Tags) > 0)
+struct HashBy {
+  using is_transparent = void;
+
+  /**
+   * @brief Hash the elements named Tags of an object
+   * @tparam Object type of NamedTuple like object
+   * @param object object to hash
+   * @return the combined hash of the elements named Tags
+   */
+  template <typename Object>
+  [[nodiscard]] constexpr std::size_t operator()(const Object& object) const {
+    std::uint64_t seed{sizeof...(Tags)};
+    ((seed = hash_combine(
+          seed, std::hash<std::remove_cvref_t<decltype(object.template get<Tags>())>>{}(
+                    object.template get<Tags>()))),
+     ...);
+    return static_cast<std::size_t>(seed);
+  }
+};
+
+/**
+ * @brief A transparent equality function object over the elements named Tags of any NamedTuple
+ * like objects
+ * @tparam Tags tags of the elements to compare
+ */
+template <StringLiteral... Tags>
+  requires(sizeof...(Tags) > 0)
+struct EqualBy {
+  using is_transparent = void;
+
+  /**
+   * @brief Compare the elements named Tags of two objects
+   * @tparam Lhs type of left hand side
+   * @tparam Rhs type of right hand side
+   * @param lhs left hand side
+   * @param rhs right hand side
+   * @return true if all elements named Tags are equal; otherwise false
+   */
+  template <typename Lhs, typename Rhs>
+  [[nodiscard]] constexpr bool operator()(const Lhs& lhs, const Rhs& rhs) const {
+    return ((lhs.template get<Tags>() == rhs.template get<Tags>()) && ...);
+  }
+};
+
+/**
+ * @brief An instance of HashBy for the given tags
+ * @tparam Tags tags of the elements to hash
+ */
+template <StringLiteral... Tags>
+inline constexpr HashBy<Tags...> hash_by{};
+
+/**
+ * @brief An instance of EqualBy for the given tags
+ * @tparam Tags tags of the elements to compare
+ */
+template <StringLiteral... Tags>
+inline constexpr EqualBy<Tags...> equal_by{};
+}  // namespace mguid
+
+// NOLINTBEGIN(cert-dcl58-cpp)
+namespace std {
+/**
+ * @brief Specialization of std::hash for NamedTuple
+ *
+ * A NamedTuple without padding whose elements are integers, enumerations or arrays of those is
+ * hashed in a single pass over its bytes, otherwise the hashes of the elements are combined in
+ * declared order.
+ *
+ * @tparam NamedTypes type list for a NamedTuple
+ */
+template <typename... NamedTypes>
+  requires(mguid::StdHashable<typename mguid::ExtractType<NamedTypes>::type> && ...)
+struct hash<mguid::NamedTuple<NamedTypes...>> {
+  [[nodiscard]] std::size_t operator()(const mguid::NamedTuple<NamedTypes...>& nt) const {
+    using NT = mguid::NamedTuple<NamedTypes...>;
+    if constexpr (sizeof...(NamedTypes) > 0 &&
+                  mguid::byte_hashable_v<NT, typename mguid::ExtractType<NamedTypes>::type...>) {
+      return static_cast<std::size_t>(
+          mguid::hash_bytes(reinterpret_cast<const std::byte*>(&nt), sizeof(NT)));
+    } else {
+      std::uint64_t seed{sizeof...(NamedTypes)};
+      [&nt, &seed]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        ((seed = mguid::hash_combine(
+              seed, std::hash<std::tuple_element_t<Indices, NT>>{}(nt.template get<Indices>()))),
+         ...);
+      }(std::index_sequence_for<NamedTypes...>{});
+      return static_cast<std::size_t>(seed);
+    }
+  }
+};
+
+/**
+ * @brief Specialization of std::hash for PackedNamedTuple
+ *
+ * Packing removes the padding of most tuples of scalars, so these are usually hashed in a single
+ * pass over their bytes, otherwise the hashes of the elements are combined in declared order.
+ *
+ * @tparam NamedTypes type list for a PackedNamedTuple
+ */
+template <typename... NamedTypes>
+  requires(mguid::StdHashable<typename mguid::ExtractType<NamedTypes>::type> && ...)
+struct hash<mguid::PackedNamedTuple<NamedTypes...>> {
+  [[nodiscard]] std::size_t operator()(
+      const mguid::PackedNamedTuple<NamedTypes...>& packed) const {
+    using Packed = mguid::PackedNamedTuple<NamedTypes...>;
+    if constexpr (sizeof...(NamedTypes) > 0 &&
+                  mguid::byte_hashable_v<Packed,
+                                         typename mguid::ExtractType<NamedTypes>::type...>) {
+      return static_cast<std::size_t>(
+          mguid::hash_bytes(reinterpret_cast<const std::byte*>(&packed), sizeof(Packed)));
+    } else {
+      std::uint64_t seed{sizeof...(NamedTypes)};
+      [&packed, &seed]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        ((seed = mguid::hash_combine(seed, std::hash<std::tuple_element_t<Indices, Packed>>{}(
+                                               packed.template get<Indices>()))),
+         ...);
+      }(std::index_sequence_for<NamedTypes...>{});
+      return static_cast<std::size_t>(seed);
+    }
+  }
+};
+}  // namespace std
+// NOLINTEND(cert-dcl58-cpp)
+
+#endif  // MGUID_NAMEDTUPLEHASH_H
@@ -0,0 +1,699 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+
+#ifndef MGUID_NAMEDTUPLEJSON_H
+#define MGUID_NAMEDTUPLEJSON_H
+
+#include "NamedTuple.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace mguid {
+
+/**
+ * @brief Maximum nesting depth of arrays and objects skipped under keys that are not in a tuple
+ */
+inline constexpr std::size_t kJsonMaxDepth{64};
+
+/**
+ * @brief Determine whether a type is written to JSON as a number
+ * @tparam Type type to check
+ */
+template <typename Type>
+concept JsonNumber =
+    std::is_floating_point_v<Type> ||
+    (std::is_integral_v<Type> && !std::is_same_v<Type, bool> && !std::is_same_v<Type, wchar_t> &&
+     !std::is_same_v<Type, char8_t> && !std::is_same_v<Type, char16_t> &&
+     !std::is_same_v<Type, char32_t>);
+
+/**
+ * @brief Base template of helper template to determine whether a type can be read from and written
+ * to JSON
+ * @tparam Type type to check
+ */
+template <typename Type>
+struct IsJsonValue : std::bool_constant<JsonNumber<Type> || std::is_same_v<Type, bool> ||
+                                        std::is_same_v<Type, std::string>> {};
+
+/**
+ * @brief An empty optional is written as null
+ * @tparam Type type of the optional value
+ */
+template <typename Type>
+struct IsJsonValue<std::optional<Type>> : IsJsonValue<Type> {};
+
+/**
+ * @brief A NamedTuple is written as an object keyed by its tags
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ */
+template <typename... NamedTypes>
+struct IsJsonValue<NamedTuple<NamedTypes...>>
+    : std::bool_constant<(IsJsonValue<typename ExtractType<NamedTypes>::type>::value && ...)> {};
+
+/**
+ * @brief Helper variable template to determine whether a type can be read from and written to JSON
+ * @tparam Type type to check
+ */
+template <typename Type>
+inline constexpr bool is_json_value_v = IsJsonValue<Type>::value;
+
+/**
+ * @brief Determine whether a type is a NamedTuple whose elements can all be read from and written
+ * to JSON
+ * @tparam NT type to check
+ */
+template <typename NT>
+concept JsonSerializable = is_named_tuple_v<NT> && is_json_value_v<NT>;
+
+/**
+ * @brief Number of characters needed to write a string as the contents of a JSON string
+ * @param sv string to escape
+ * @return the length of sv after escaping quotes, backslashes and control characters
+ */
+[[nodiscard]] constexpr std::size_t json_escaped_size(std::string_view sv) noexcept {
+  std::size_t size{0};
+  for (const char c : sv) {
+    if (c == '"' || c == '\\') {
+      size += 2;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      size += 6;
+    } else {
+      size += 1;
+    }
+  }
+  return size;
+}
+
+/**
+ * @brief Escape a string as the contents of a JSON string
+ * @tparam Output type of output iterator
+ * @param sv string to escape
+ * @param output iterator to write the escaped characters to
+ * @return the output iterator past the last written character
+ */
+template <typename Output>
+constexpr Output json_escape(std::string_view sv, Output output) {
+  constexpr std::string_view kHex{"0123456789abcdef"};
+  for (const char c : sv) {
+    const auto byte = static_cast<unsigned char>(c);
+    if (c == '"' || c == '\\') {
+      *output++ = '\\';
+      *output++ = c;
+    } else if (byte < 0x20) {
+      for (const char escaped : {'\\', 'u', '0', '0', kHex[byte >> 4], kHex[byte & 0xF]}) {
+        *output++ = escaped;
+      }
+    } else {
+      *output++ = c;
+    }
+  }
+  return output;
+}
+
+/**
+ * @brief The quoted and escaped key of a tag followed by a colon, preceded by a comma unless the
+ * key belongs to the first element of an object, built at compile time
+ * @tparam Tag tag to write as a key
+ * @tparam First true if the key belongs to the first element of an object
+ */
+template <StringLiteral Tag, bool First>
+inline constexpr auto kJsonKey = [] {
+  constexpr std::string_view name{Tag.value, Tag.size - 1};
+  std::array<char, json_escaped_size(name) + (First ? 3 : 4)> result{};
+  auto output = result.begin();
+  if constexpr (!First) { *output++ = ','; }
+  *output++ = '"';
+  output = json_escape(name, output);
+  *output++ = '"';
+  *output = ':';
+  return result;
+}();
+
+/**
+ * @brief Appends JSON text for values of types accepted by is_json_value_v to a string
+ */
+class JsonWriter {
+public:
+  /**
+   * @brief Construct a writer appending to out
+   * @param out string to append to
+   */
+  explicit JsonWriter(std::string& out) noexcept : m_out{out} {}
+
+  /**
+   * @brief Append a value as JSON
+   * @tparam Type type of value
+   * @param value value to append
+   */
+  template <typename Type>
+    requires(is_json_value_v<Type>)
+  void write(const Type& value) {
+    if constexpr (std::is_same_v<Type, bool>) {
+      m_out.append(value ? std::string_view{"true"} : std::string_view{"false"});
+    } else if constexpr (JsonNumber<Type>) {
+      write_number(value);
+    } else if constexpr (std::is_same_v<Type, std::string>) {
+      write_string(value);
+    } else if constexpr (is_named_tuple_v<Type>) {
+      write_object(value);
+    } else {
+      if (value.has_value()) {
+        write(*value);
+      } else {
+        m_out.append("null");
+      }
+    }
+  }
+
+private:
+  template <typename Number>
+  void write_number(Number value) {
+    if constexpr (std::is_floating_point_v<Number>) {
+      // JSON has no representation of infinity or NaN
+      if (!std::isfinite(value)) {
+        m_out.append("null");
+        return;
+      }
+    }
+    std::array<char, 32> buffer{};
+    const auto [end, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    m_out.append(buffer.data(), end);
+  }
+
+  void write_string(std::string_view sv) {
+    m_out.push_back('"');
+    // append runs of characters that need no escaping in a single copy
+    std::size_t begin{0};
+    for (std::size_t index{0}; index < sv.size(); ++index) {
+      const char c = sv[index];
+      if (c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20) {
+        m_out.append(sv.data() + begin, index - begin);
+        std::array<char, 6> escaped{};
+        const auto end = json_escape(sv.substr(index, 1), escaped.begin());
+        m_out.append(escaped.begin(), end);
+        begin = index + 1;
+      }
+    }
+    m_out.append(sv.data() + begin, sv.size() - begin);
+    m_out.push_back('"');
+  }
+
+  template <typename... NamedTypes>
+  void write_object(const NamedTuple<NamedTypes...>& nt) {
+    m_out.push_back('{');
+    [this, &nt]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+      ((m_out.append(kJsonKey<NamedTypes{}.tag(), Indices == 0>.data(),
+                     kJsonKey<NamedTypes{}.tag(), Indices == 0>.size()),
+        write(nt.template get<Indices>())),
+       ...);
+    }(std::index_sequence_for<NamedTypes...>{});
+    m_out.push_back('}');
+  }
+
+  std::string& m_out;
+};
+
+/**
+ * @brief Reads values of types accepted by is_json_value_v from JSON text without building an
+ * intermediate document
+ *
+ * Numbers must follow the JSON grammar, so leading zeros, inf and nan are rejected. A null read
+ * into a floating point element is NaN, the reverse of writing non finite numbers as null.
+ */
+class JsonReader {
+public:
+  /**
+   * @brief Construct a reader over JSON text
+   * @param json text to read
+   */
+  explicit JsonReader(std::string_view json) noexcept
+      : m_current{json.data()}, m_end{json.data() + json.size()} {}
+
+  /**
+   * @brief Read a value, keys of objects are mapped to elements of a NamedTuple through its perfect
+   * tag hash, elements without a key are left unchanged and keys without an element are skipped
+   * @tparam Type type of value
+   * @param value value to overwrite
+   * @return true if a value of the right type was read; otherwise false
+   */
+  template <typename Type>
+    requires(is_json_value_v<Type>)
+  bool read(Type& value) {
+    skip_whitespace();
+    if constexpr (std::is_same_v<Type, bool>) {
+      if (consume_literal("true")) {
+        value = true;
+        return true;
+      }
+      if (consume_literal("false")) {
+        value = false;
+        return true;
+      }
+      return false;
+    } else if constexpr (JsonNumber<Type>) {
+      return read_number(value);
+    } else if constexpr (std::is_same_v<Type, std::string>) {
+      return consume('"') && read_string_contents(value);
+    } else if constexpr (is_named_tuple_v<Type>) {
+      return read_object(value);
+    } else {
+      if (consume_literal("null")) {
+        value.reset();
+        return true;
+      }
+      if (!value.has_value()) { value.emplace(); }
+      return read(*value);
+    }
+  }
+
+  /**
+   * @brief Skip trailing whitespace and check that all of the text was read
+   * @return true if nothing but whitespace is left; otherwise false
+   */
+  [[nodiscard]] bool finished() noexcept {
+    skip_whitespace();
+    return m_current == m_end;
+  }
+
+private:
+  void skip_whitespace() noexcept {
+    while (m_current != m_end &&
+           (*m_current == ' ' || *m_current == '\n' || *m_current == '\r' || *m_current == '\t')) {
+      ++m_current;
+    }
+  }
+
+  bool consume(char c) noexcept {
+    skip_whitespace();
+    if (m_current == m_end || *m_current != c) { return false; }
+    ++m_current;
+    return true;
+  }
+
+  bool consume_literal(std::string_view literal) noexcept {
+    if (static_cast<std::size_t>(m_end - m_current) < literal.size() ||
+        std::string_view{m_current, literal.size()} != literal) {
+      return false;
+    }
+    m_current += literal.size();
+    return true;
+  }
+
+  template <typename Number>
+  bool read_number(Number& value) {
+    if constexpr (std::is_floating_point_v<Number>) {
+      if (consume_literal("null")) {
+        value = std::numeric_limits<Number>::quiet_NaN();
+        return true;
+      }
+    }
+    const char* const number_end = scan_number();
+    if (number_end == nullptr) { return false; }
+    const auto [end, ec] = std::from_chars(m_current, number_end, value);
+    if (ec != std::errc{} || end != number_end) { return false; }
+    m_current = end;
+    return true;
+  }
+
+  // end of the number at the current position under the JSON grammar, or nullptr if there is none,
+  // since std::from_chars also accepts leading zeros, inf and nan
+  [[nodiscard]] const char* scan_number() const noexcept {
+    const char* it = m_current;
+    const auto digits = [&it, this] {
+      const char* const begin = it;
+      while (it != m_end && *it >= '0' && *it <= '9') { ++it; }
+      return it != begin;
+    };
+    if (it != m_end && *it == '-') { ++it; }
+    if (it != m_end && *it == '0') {
+      ++it;
+    } else if (!digits()) {
+      return nullptr;
+    }
+    if (it != m_end && *it == '.') {
+      ++it;
+      if (!digits()) { return nullptr; }
+    }
+    if (it != m_end && (*it == 'e' || *it == 'E')) {
+      ++it;
+      if (it != m_end && (*it == '+' || *it == '-')) { ++it; }
+      if (!digits()) { return nullptr; }
+    }
+    return it;
+  }
+
+  bool read_hex(std::uint32_t& code_point) noexcept {
+    if (m_end - m_current < 4) { return false; }
+    const auto [end, ec] = std::from_chars(m_current, m_current + 4, code_point, 16);
+    if (ec != std::errc{} || end != m_current + 4) { return false; }
+    m_current = end;
+    return true;
+  }
+
+  bool read_escape(std::string& out) {
+    if (m_current == m_end) { return false; }
+    switch (*m_current++) {
+      case '"': out.push_back('"'); return true;
+      case '\\': out.push_back('\\'); return true;
+      case '/': out.push_back('/'); return true;
+      case 'b': out.push_back('\b'); return true;
+      case 'f': out.push_back('\f'); return true;
+      case 'n': out.push_back('\n'); return true;
+      case 'r': out.push_back('\r'); return true;
+      case 't': out.push_back('\t'); return true;
+      case 'u': break;
+      default: return false;
+    }
+
+    std::uint32_t code_point{};
+    if (!read_hex(code_point)) { return false; }
+    if (code_point >= 0xD800 && code_point < 0xDC00) {
+      std::uint32_t low{};
+      if (!consume_literal("\\u") || !read_hex(low) || low < 0xDC00 || low >= 0xE000) {
+        return false;
+      }
+      code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+    } else if (code_point >= 0xDC00 && code_point < 0xE000) {
+      return false;
+    }
+
+    if (code_point < 0x80) {
+      out.push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800) {
+      out.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+      out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+      out.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+      out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+      out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else {
+      out.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+      out.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+      out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+      out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+    return true;
+  }
+
+  // reads the contents of a string after the opening quote, appending runs without escapes in a
+  // single copy
+  bool read_string_contents(std::string& out) {
+    out.clear();
+    const char* begin{m_current};
+    while (m_current != m_end) {
+      const char c = *m_current;
+      if (c == '"') {
+        out.append(begin, m_current);
+        ++m_current;
+        return true;
+      }
+      if (static_cast<unsigned char>(c) < 0x20) { return false; }
+      if (c == '\\') {
+        out.append(begin, m_current);
+        ++m_current;
+        if (!read_escape(out)) { return false; }
+        begin = m_current;
+      } else {
+        ++m_current;
+      }
+    }
+    return false;
+  }
+
+  // reads a key after the opening quote, keys without escapes are viewed in place
+  bool read_key(std::string_view& key) {
+    const char* begin{m_current};
+    while (m_current != m_end && *m_current != '"' && *m_current != '\\') { ++m_current; }
+    if (m_current == m_end) { return false; }
+    if (*m_current == '"') {
+      key = std::string_view{begin, m_current};
+      ++m_current;
+      return true;
+    }
+    m_current = begin;
+    if (!read_string_contents(m_scratch)) { return false; }
+    key = m_scratch;
+    return true;
+  }
+
+  bool skip_value(std::size_t depth) {
+    if (depth > kJsonMaxDepth) { return false; }
+    skip_whitespace();
+    if (m_current == m_end) { return false; }
+    switch (*m_current) {
+      case '"': {
+        ++m_current;
+        std::string_view ignored{};
+        return read_key(ignored);
+      }
+      case '{':
+      case '[': {
+        const char close = *m_current == '{' ? '}' : ']';
+        ++m_current;
+        if (consume(close)) { return true; }
+        do {
+          if (close == '}') {
+            std::string_view ignored{};
+            if (!consume('"') || !read_key(ignored) || !consume(':')) { return false; }
+          }
+          if (!skip_value(depth + 1)) { return false; }
+        } while (consume(','));
+        return consume(close);
+      }
+      case 't': return consume_literal("true");
+      case 'f': return consume_literal("false");
+      case 'n': return consume_literal("null");
+      default: {
+        double ignored{};
+        return read_number(ignored);
+      }
+    }
+  }
+
+  template <typename... NamedTypes>
+  bool read_object(NamedTuple<NamedTypes...>& nt) {
+    using NT = NamedTuple<NamedTypes...>;
+    static constexpr std::array<std::string_view, sizeof...(NamedTypes)> kNames{
+        NamedTypes::name()...};
+    if (!consume('{')) { return false; }
+    if (consume('}')) { return true; }
+    std::size_t expected{0};
+    do {
+      std::string_view key{};
+      if (!consume('"') || !read_key(key) || !consume(':')) { return false; }
+      // objects written by to_json hold the keys in declared order, so try the element after the
+      // previous one before hashing the key
+      std::optional<std::size_t> index{};
+      if (expected < sizeof...(NamedTypes) && kNames[expected] == key) {
+        index = expected;
+      } else {
+        index = NT::index_of(key);
+      }
+      if (index.has_value()) {
+        bool read_element{false};
+        nt.visit_by_index(*index, [this, &read_element](auto& value) {
+          read_element = read(value);
+        });
+        if (!read_element) { return false; }
+        expected = *index + 1;
+      } else if (!skip_value(0)) {
+        return false;
+      }
+    } while (consume(','));
+    return consume('}');
+  }
+
+  const char* m_current;
+  const char* m_end;
+  std::string m_scratch{};
+};
+
+/**
+ * @brief Append a NamedTuple to a string as a JSON object keyed by its tags
+ *
+ * Keys are quoted and escaped at compile time, so every element costs one copy of its key and the
+ * formatting of its value.
+ *
+ * @tparam NT type of NamedTuple
+ * @param nt NamedTuple to write
+ * @param out string to append to
+ */
+template <JsonSerializable NT>
+void to_json(const NT& nt, std::string& out) {
+  JsonWriter{out}.write(nt);
+}
+
+/**
+ * @brief Write a NamedTuple as a JSON object keyed by its tags
+ * @tparam NT type of NamedTuple
+ * @param nt NamedTuple to write
+ * @return a string holding the JSON object
+ */
+template <JsonSerializable NT>
+[[nodiscard]] std::string to_json(const NT& nt) {
+  std::string out{};
+  to_json(nt, out);
+  return out;
+}
+
+/**
+ * @brief Read a JSON object into an existing NamedTuple
+ * @tparam NT type of NamedTuple
+ * @param json text holding a single JSON object, optionally surrounded by whitespace
+ * @param nt NamedTuple to overwrite, elements whose key is missing are left unchanged
+ * @return true if json held a single object whose values have the types of the matching elements;
+ * otherwise false and nt may be partially overwritten
+ */
+template <JsonSerializable NT>
+bool from_json(std::string_view json, NT& nt) {
+  JsonReader reader{json};
+  return reader.read(nt) && reader.finished();
+}
+
+/**
+ * @brief Read a JSON object into a new NamedTuple
+ * @tparam NT type of NamedTuple
+ * @param json text holding a single JSON object, optionally surrounded by whitespace
+ * @return the NamedTuple read from json, elements whose key is missing are value initialized, if
+ * json held a single object whose values have the types of the matching elements; otherwise
+ * std::nullopt
+ */
+template <JsonSerializable NT>
+[[nodiscard]] std::optional<NT> from_json(std::string_view json) {
+  std::optional<NT> result{std::in_place};
+  if (!from_json(json, *result)) { result.reset(); }
+  return result;
+}
+
+/**
+ * @brief Decodes a stream of JSON objects separated by whitespace, such as newline delimited JSON,
+ * that arrives in chunks split at arbitrary positions
+ *
+ * Objects that lie entirely within a chunk are read in place, only an object split across chunks
+ * is copied into an internal buffer.
+ *
+ * @tparam NT type of NamedTuple to decode every object into
+ */
+template <JsonSerializable NT>
+class JsonStreamDecoder {
+public:
+  /**
+   * @brief Decode the next chunk of the stream, invoking callback with every completed object
+   * @tparam Callback type of callback, invocable with an rvalue of NT
+   * @param chunk next chunk of the stream
+   * @param callback callback to invoke with every decoded NamedTuple
+   * @return true if all objects completed so far were well formed; otherwise false, the objects
+   * before the malformed one have been passed to callback and the decoder is reset
+   */
+  template <typename Callback>
+  bool feed(std::string_view chunk, Callback&& callback) {
+    std::size_t begin{0};
+    for (std::size_t index{0}; index < chunk.size(); ++index) {
+      const char c = chunk[index];
+      if (m_in_string) {
+        if (m_escaped) {
+          m_escaped = false;
+        } else if (c == '\\') {
+          m_escaped = true;
+        } else if (c == '"') {
+          m_in_string = false;
+        }
+        continue;
+      }
+      if (m_depth == 0) {
+        if (c == ' ' || c == '\n' || c == '\r' || c == '\t') { continue; }
+        if (c != '{') { return fail(); }
+        begin = index;
+      }
+      if (c == '"') {
+        m_in_string = true;
+      } else if (c == '{') {
+        ++m_depth;
+      } else if (c == '}' && --m_depth == 0) {
+        std::string_view record{chunk.substr(begin, index + 1 - begin)};
+        if (!m_partial.empty()) {
+          m_partial.append(record);
+          record = m_partial;
+        }
+        std::optional<NT> nt{from_json<NT>(record)};
+        m_partial.clear();
+        if (!nt.has_value()) { return fail(); }
+        std::invoke(callback, std::move(*nt));
+      }
+    }
+    if (m_depth != 0) { m_partial.append(chunk.substr(begin)); }
+    return true;
+  }
+
+  /**
+   * @brief Check whether the decoder is between objects
+   * @return true if no partially received object is pending; otherwise false
+   */
+  [[nodiscard]] bool idle() const noexcept { return m_depth == 0; }
+
+  /**
+   * @brief Discard any partially received object
+   */
+  void reset() noexcept {
+    m_partial.clear();
+    m_depth = 0;
+    m_in_string = false;
+    m_escaped = false;
+  }
+
+private:
+  bool fail() noexcept {
+    reset();
+    return false;
+  }
+
+  std::string m_partial{};
+  std::size_t m_depth{0};
+  bool m_in_string{false};
+  bool m_escaped{false};
+};
+
+}  // namespace mguid
+
+#endif  // MGUID_NAMEDTUPLEJSON_H
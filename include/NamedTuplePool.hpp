@@ -0,0 +1,291 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+
+#ifndef MGUID_NAMEDTUPLEPOOL_H
+#define MGUID_NAMEDTUPLEPOOL_H
+
+#include "NamedTuple.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mguid {
+
+template <typename NT, bool KeepConstructed>
+  requires(std::is_object_v<NT> && alignof(NT) <= kCacheLineSize)
+class NamedTuplePool;
+
+/**
+ * @brief Deleter returning a record to the NamedTuplePool it was acquired from
+ * @tparam NT type of the pooled records
+ * @tparam KeepConstructed whether released records stay constructed for reuse
+ */
+template <typename NT, bool KeepConstructed>
+struct NamedTuplePoolDeleter {
+  /**
+   * @brief Return a record to its pool
+   * @param record record acquired from NamedTuplePool<NT, KeepConstructed>
+   */
+  void operator()(NT* record) const noexcept {
+    NamedTuplePool<NT, KeepConstructed>::release(record);
+  }
+};
+
+/**
+ * @brief Owning handle to a record acquired from a NamedTuplePool
+ * @tparam NT type of the pooled records
+ * @tparam KeepConstructed whether released records stay constructed for reuse
+ */
+template <typename NT, bool KeepConstructed = false>
+using PoolPtr = std::unique_ptr<NT, NamedTuplePoolDeleter<NT, KeepConstructed>>;
+
+/**
+ * @brief A slab pool of fixed size records with per-thread free lists
+ *
+ * Every thread allocates from its own heap of slabs, each slab is aligned to its size so the heap
+ * that owns a record is found from the address of the record alone. A record released on its
+ * owning thread goes back on the free list of that thread without synchronization; a record
+ * released on another thread is pushed onto a lock-free list of the owning heap, which the owner
+ * takes back in one batch when its free list runs dry. When a thread exits its heap is handed to
+ * the next thread that uses the pool, so records may outlive the thread that acquired them. Slabs
+ * are never freed, the memory of a pool is bounded by the most records it held at once.
+ *
+ * With KeepConstructed, released records are not destroyed, acquire returns a recycled record as it
+ * was left, e.g. with the capacity of its strings retained. Records are value initialized the first
+ * time their slot is used and are never destroyed.
+ *
+ * All NamedTuplePool of the same type share their heaps, the class only has static members.
+ *
+ * @tparam NT type of the pooled records
+ * @tparam KeepConstructed whether released records stay constructed for reuse
+ */
+template <typename NT, bool KeepConstructed = false>
+  requires(std::is_object_v<NT> && alignof(NT) <= kCacheLineSize)
+class NamedTuplePool {
+  struct Heap;
+
+  struct Slot {
+    alignas(NT) std::byte storage[sizeof(NT)];
+    Slot* next;
+  };
+
+  struct alignas(kCacheLineSize) SlabHeader {
+    Heap* owner;
+    SlabHeader* next;
+  };
+
+public:
+  using Handle = PoolPtr<NT, KeepConstructed>;
+
+  /// Size and alignment of a slab, at least 64 KiB and at least 64 records
+  static constexpr std::size_t kSlabSize{
+      std::max<std::size_t>(std::size_t{1} << 16,
+                            std::bit_ceil(sizeof(SlabHeader) + 64 * sizeof(Slot)))};
+
+  /// Number of records carved from every slab
+  static constexpr std::size_t kSlotsPerSlab{(kSlabSize - sizeof(SlabHeader)) / sizeof(Slot)};
+
+  NamedTuplePool() = delete;
+
+  /**
+   * @brief Acquire a record constructed from args
+   * @tparam Args types of the constructor arguments
+   * @param args arguments to construct the record from
+   * @return a handle owning the record
+   */
+  template <typename... Args>
+    requires(!KeepConstructed && std::is_constructible_v<NT, Args...>)
+  [[nodiscard]] static Handle make(Args&&... args) {
+    Slot* slot{local().pop()};
+    try {
+      return Handle{std::construct_at(reinterpret_cast<NT*>(slot->storage),
+                                      std::forward<Args>(args)...)};
+    } catch (...) {
+      local().push(slot);
+      throw;
+    }
+  }
+
+  /**
+   * @brief Acquire a record
+   *
+   * Without KeepConstructed the record is value initialized. With KeepConstructed the record is
+   * value initialized the first time its slot is used and otherwise holds the values it was
+   * released with.
+   *
+   * @return a handle owning the record
+   */
+  [[nodiscard]] static Handle acquire() {
+    if constexpr (KeepConstructed) {
+      return Handle{reinterpret_cast<NT*>(local().pop()->storage)};
+    } else {
+      return make();
+    }
+  }
+
+  /**
+   * @brief Return a record to its heap, called by the deleter of Handle
+   * @param record record acquired from this pool
+   */
+  static void release(NT* record) noexcept {
+    if (record == nullptr) { return; }
+    if constexpr (!KeepConstructed) { std::destroy_at(record); }
+
+    auto* slot = reinterpret_cast<Slot*>(record);
+    Heap* owner{slab_of(slot)->owner};
+    Heap* current{tl_heap};
+    if (owner == current) {
+      current->push(slot);
+    } else {
+      owner->push_remote(slot);
+    }
+  }
+
+  /**
+   * @brief Get the number of slabs owned by the heap of the calling thread
+   * @return the number of slabs owned by the heap of the calling thread
+   */
+  [[nodiscard]] static std::size_t local_slab_count() { return local().slab_count; }
+
+private:
+  struct Heap {
+    Slot* pop() {
+      if (free == nullptr) { free = remote.exchange(nullptr, std::memory_order_acquire); }
+      if (free != nullptr) {
+        Slot* slot{free};
+        free = slot->next;
+        return slot;
+      }
+      return carve();
+    }
+
+    void push(Slot* slot) noexcept {
+      slot->next = free;
+      free = slot;
+    }
+
+    void push_remote(Slot* slot) noexcept {
+      Slot* head{remote.load(std::memory_order_relaxed)};
+      do {
+        slot->next = head;
+      } while (!remote.compare_exchange_weak(head, slot, std::memory_order_release,
+                                             std::memory_order_relaxed));
+    }
+
+    Slot* carve() {
+      if (bump == bump_end) {
+        void* memory{::operator new(kSlabSize, std::align_val_t{kSlabSize})};
+        auto* slab = ::new (memory) SlabHeader{this, slabs};
+        slabs = slab;
+        ++slab_count;
+        bump = reinterpret_cast<Slot*>(reinterpret_cast<std::byte*>(slab) + sizeof(SlabHeader));
+        bump_end = bump + kSlotsPerSlab;
+      }
+      Slot* slot{bump};
+      if constexpr (KeepConstructed) { ::new (static_cast<void*>(slot->storage)) NT(); }
+      ++bump;
+      return slot;
+    }
+
+    Slot* free{nullptr};
+    Slot* bump{nullptr};
+    Slot* bump_end{nullptr};
+    SlabHeader* slabs{nullptr};
+    std::size_t slab_count{0};
+    alignas(kCacheLineSize) std::atomic<Slot*> remote{nullptr};
+  };
+
+  struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Heap>> heaps;
+    std::vector<Heap*> orphans;
+  };
+
+  struct ThreadCache {
+    ThreadCache() {
+      Registry& reg{registry()};
+      const std::scoped_lock lock{reg.mutex};
+      if (reg.orphans.empty()) {
+        // every heap owns a slot in orphans so that returning it in the destructor cannot throw
+        reg.orphans.reserve(reg.heaps.size() + 1);
+        heap = reg.heaps.emplace_back(std::make_unique<Heap>()).get();
+      } else {
+        heap = reg.orphans.back();
+        reg.orphans.pop_back();
+      }
+      tl_heap = heap;
+    }
+
+    ~ThreadCache() {
+      tl_heap = nullptr;
+      Registry& reg{registry()};
+      const std::scoped_lock lock{reg.mutex};
+      reg.orphans.push_back(heap);  // never reallocates, see the constructor
+    }
+
+    ThreadCache(const ThreadCache&) = delete;
+    ThreadCache& operator=(const ThreadCache&) = delete;
+
+    Heap* heap;
+  };
+
+  static Registry& registry() {
+    // never destroyed, thread caches may return their heaps after static destructors have run
+    static Registry* const instance{new Registry{}};
+    return *instance;
+  }
+
+  static Heap& local() {
+    thread_local ThreadCache cache;
+    return *cache.heap;
+  }
+
+  static SlabHeader* slab_of(Slot* slot) noexcept {
+    return reinterpret_cast<SlabHeader*>(reinterpret_cast<std::uintptr_t>(slot) &
+                                         ~(std::uintptr_t{kSlabSize} - 1));
+  }
+
+  static inline thread_local Heap* tl_heap{nullptr};
+};
+
+}  // namespace mguid
+
+#endif  // MGUID_NAMEDTUPLEPOOL_H
@@ -0,0 +1,899 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+
+#ifndef MGUID_NAMEDTUPLEQUERY_H
+#define MGUID_NAMEDTUPLEQUERY_H
+
+#include "NamedTuple.hpp"
+#include "NamedTupleAlgorithms.hpp"
+#include "NamedTupleColumns.hpp"
+#include "NamedTupleHash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mguid {
+
+/**
+ * @brief Number of rows a query evaluates at a time, small enough that the selection vector and the
+ * slices of the columns it touches stay in cache between the filter and aggregation passes
+ */
+inline constexpr std::size_t kQueryChunkRows{2048};
+
+/**
+ * @brief The value type of the column named Tag of a NamedTupleColumns
+ * @tparam Tag the tag of the column
+ * @tparam Columns type of NamedTupleColumns
+ */
+template <StringLiteral Tag, typename Columns>
+using ColumnValueT = std::remove_cv_t<
+    typename decltype(std::declval<const Columns&>().template column<Tag>())::element_type>;
+
+/**
+ * @brief A predicate comparing a value with a bound
+ * @tparam Compare type of comparison function object, called as Compare{}(value, bound)
+ * @tparam Bound type of bound
+ */
+template <typename Compare, typename Bound>
+struct CompareWith {
+  Bound bound;
+
+  /**
+   * @brief Compare a value with the bound
+   * @tparam Value type of value
+   * @param value value to compare
+   * @return the result of the comparison
+   */
+  template <typename Value>
+  [[nodiscard]] constexpr bool operator()(const Value& value) const {
+    return Compare{}(value, bound);
+  }
+};
+
+/**
+ * @brief A predicate testing whether a value lies in a closed interval
+ * @tparam Bound type of bounds
+ */
+template <typename Bound>
+struct Between {
+  Bound low;
+  Bound high;
+
+  /**
+   * @brief Test whether a value lies in the interval
+   * @tparam Value type of value
+   * @param value value to test
+   * @return true if low <= value <= high; otherwise false
+   */
+  template <typename Value>
+  [[nodiscard]] constexpr bool operator()(const Value& value) const {
+    return !(value < low) && !(high < value);
+  }
+};
+
+/**
+ * @brief Make a predicate testing value == bound
+ * @tparam Bound type of bound
+ * @param bound value to compare with
+ * @return the predicate
+ */
+template <typename Bound>
+[[nodiscard]] constexpr CompareWith<std::equal_to<>, Bound> eq(Bound bound) {
+  return {std::move(bound)};
+}
+
+/**
+ * @brief Make a predicate testing value != bound
+ * @tparam Bound type of bound
+ * @param bound value to compare with
+ * @return the predicate
+ */
+template <typename Bound>
+[[nodiscard]] constexpr CompareWith<std::not_equal_to<>, Bound> ne(Bound bound) {
+  return {std::move(bound)};
+}
+
+/**
+ * @brief Make a predicate testing value < bound
+ * @tparam Bound type of bound
+ * @param bound value to compare with
+ * @return the predicate
+ */
+template <typename Bound>
+[[nodiscard]] constexpr CompareWith<std::less<>, Bound> lt(Bound bound) {
+  return {std::move(bound)};
+}
+
+/**
+ * @brief Make a predicate testing value <= bound
+ * @tparam Bound type of bound
+ * @param bound value to compare with
+ * @return the predicate
+ */
+template <typename Bound>
+[[nodiscard]] constexpr CompareWith<std::less_equal<>, Bound> le(Bound bound) {
+  return {std::move(bound)};
+}
+
+/**
+ * @brief Make a predicate testing value > bound
+ * @tparam Bound type of bound
+ * @param bound value to compare with
+ * @return the predicate
+ */
+template <typename Bound>
+[[nodiscard]] constexpr CompareWith<std::greater<>, Bound> gt(Bound bound) {
+  return {std::move(bound)};
+}
+
+/**
+ * @brief Make a predicate testing value >= bound
+ * @tparam Bound type of bound
+ * @param bound value to compare with
+ * @return the predicate
+ */
+template <typename Bound>
+[[nodiscard]] constexpr CompareWith<std::greater_equal<>, Bound> ge(Bound bound) {
+  return {std::move(bound)};
+}
+
+/**
+ * @brief Make a predicate testing low <= value <= high
+ * @tparam Bound type of bounds
+ * @param low smallest accepted value
+ * @param high largest accepted value
+ * @return the predicate
+ */
+template <typename Bound>
+[[nodiscard]] constexpr Between<Bound> between(Bound low, Bound high) {
+  return {std::move(low), std::move(high)};
+}
+
+/**
+ * @brief A filter of a query, keeping the rows whose column named Tag satisfies a predicate
+ *
+ * Rows are selected into a selection vector of offsets into the current chunk. Both kernels write
+ * every candidate and advance the output by the result of the predicate, so they do not branch on
+ * the data, and the dense kernel evaluates the predicate over the contiguous column slice in a
+ * separate loop the compiler can vectorize.
+ *
+ * @tparam Tag the tag of the column to test
+ * @tparam Predicate type of predicate
+ */
+template <StringLiteral Tag, typename Predicate>
+struct Where {
+  Predicate predicate;
+
+  /**
+   * @brief Select the rows of a chunk that satisfy the predicate
+   * @tparam Columns type of NamedTupleColumns
+   * @param columns container the chunk belongs to
+   * @param begin index of the first row of the chunk
+   * @param length number of rows in the chunk, at most kQueryChunkRows
+   * @param rows selection vector receiving the offsets of the selected rows
+   * @return the number of selected rows
+   */
+  template <typename Columns>
+  [[nodiscard]] std::size_t select_dense(const Columns& columns, std::size_t begin,
+                                         std::size_t length,
+                                         std::span<std::uint32_t, kQueryChunkRows> rows) const {
+    const auto column = columns.template column<Tag>().subspan(begin, length);
+    std::array<std::uint8_t, kQueryChunkRows> matches;
+    for (std::size_t index{0}; index < length; ++index) {
+      matches[index] = static_cast<std::uint8_t>(static_cast<bool>(predicate(column[index])));
+    }
+    std::size_t count{0};
+    for (std::size_t index{0}; index < length; ++index) {
+      rows[count] = static_cast<std::uint32_t>(index);
+      count += matches[index];
+    }
+    return count;
+  }
+
+  /**
+   * @brief Narrow a selection vector to the rows that satisfy the predicate
+   * @tparam Columns type of NamedTupleColumns
+   * @param columns container the chunk belongs to
+   * @param begin index of the first row of the chunk
+   * @param rows the selected offsets, narrowed in place keeping their order
+   * @return the number of rows still selected
+   */
+  template <typename Columns>
+  [[nodiscard]] std::size_t select_sparse(const Columns& columns, std::size_t begin,
+                                          std::span<std::uint32_t> rows) const {
+    const auto column = columns.template column<Tag>().subspan(begin);
+    std::size_t count{0};
+    for (const std::uint32_t row : rows) {
+      rows[count] = row;
+      count += static_cast<std::size_t>(static_cast<bool>(predicate(column[row])));
+    }
+    return count;
+  }
+};
+
+/**
+ * @brief The state an aggregate keeps for each group of a query over Columns
+ * @tparam Aggregate type of aggregate
+ * @tparam Columns type of NamedTupleColumns
+ */
+template <typename Aggregate, typename Columns>
+using AggregateStateT = typename Aggregate::template State<Columns>;
+
+/**
+ * @brief The value an aggregate produces for each group of a query over Columns
+ * @tparam Aggregate type of aggregate
+ * @tparam Columns type of NamedTupleColumns
+ */
+template <typename Aggregate, typename Columns>
+using AggregateResultT =
+    decltype(Aggregate::result(std::declval<const AggregateStateT<Aggregate, Columns>&>()));
+
+/**
+ * @brief An aggregate summing the column named Tag into the result column named As
+ *
+ * The sum is accumulated and returned in SumValueT of the column type, so summing a narrow integer
+ * column doesn't overflow the type of its elements.
+ *
+ * Like every aggregate, accumulate adds the selected rows of a chunk to the states of their groups,
+ * or to the single state when groups is empty, merge combines the states of the same group from two
+ * threads and result produces the value of the output column.
+ *
+ * @tparam Tag the tag of the column to sum
+ * @tparam As the tag of the result column
+ */
+template <StringLiteral Tag, StringLiteral As = Tag>
+struct SumOf {
+  static constexpr auto kName{As};
+
+  template <typename Columns>
+  using State = SumValueT<ColumnValueT<Tag, Columns>>;
+
+  template <typename Columns>
+  static void accumulate(std::span<State<Columns>> states, const Columns& columns,
+                         std::size_t begin, std::span<const std::uint32_t> rows,
+                         std::span<const std::uint32_t> groups) {
+    const auto column = columns.template column<Tag>().subspan(begin);
+    if (groups.empty()) {
+      State<Columns> total{};
+      for (const std::uint32_t row : rows) { total += column[row]; }
+      states.front() += total;
+      return;
+    }
+    for (std::size_t index{0}; index < rows.size(); ++index) {
+      states[groups[index]] += column[rows[index]];
+    }
+  }
+
+  template <typename State>
+  static void merge(State& into, const State& from) {
+    into += from;
+  }
+
+  template <typename State>
+  [[nodiscard]] static State result(const State& state) {
+    return state;
+  }
+};
+
+/**
+ * @brief The state of MinOf and MaxOf, the extremum seen so far if any value was seen
+ * @tparam Value type of value
+ */
+template <typename Value>
+struct ExtremumState {
+  Value value{};
+  bool seen{false};
+};
+
+/**
+ * @brief An aggregate keeping the smallest or largest value of the column named Tag in the result
+ * column named As, value initialized if no row was selected
+ * @tparam Tag the tag of the column to search
+ * @tparam As the tag of the result column
+ * @tparam Compare type of comparison, keeping a new value when Compare{}(value, extremum)
+ */
+template <StringLiteral Tag, StringLiteral As, typename Compare>
+struct ExtremumOf {
+  static constexpr auto kName{As};
+
+  template <typename Columns>
+  using State = ExtremumState<ColumnValueT<Tag, Columns>>;
+
+  template <typename Columns>
+  static void accumulate(std::span<State<Columns>> states, const Columns& columns,
+                         std::size_t begin, std::span<const std::uint32_t> rows,
+                         std::span<const std::uint32_t> groups) {
+    const auto column = columns.template column<Tag>().subspan(begin);
+    if (groups.empty()) {
+      State<Columns> extremum{};
+      for (const std::uint32_t row : rows) { keep(extremum, column[row]); }
+      merge(states.front(), extremum);
+      return;
+    }
+    for (std::size_t index{0}; index < rows.size(); ++index) {
+      keep(states[groups[index]], column[rows[index]]);
+    }
+  }
+
+  template <typename State>
+  static void merge(State& into, const State& from) {
+    if (from.seen) { keep(into, from.value); }
+  }
+
+  template <typename State>
+  [[nodiscard]] static auto result(const State& state) {
+    return state.value;
+  }
+
+private:
+  template <typename State, typename Value>
+  static void keep(State& state, const Value& value) {
+    if (!state.seen || Compare{}(value, state.value)) {
+      state.value = value;
+      state.seen = true;
+    }
+  }
+};
+
+/**
+ * @brief An aggregate keeping the smallest value of the column named Tag
+ * @tparam Tag the tag of the column to search
+ * @tparam As the tag of the result column
+ */
+template <StringLiteral Tag, StringLiteral As = Tag>
+using MinOf = ExtremumOf<Tag, As, std::less<>>;
+
+/**
+ * @brief An aggregate keeping the largest value of the column named Tag
+ * @tparam Tag the tag of the column to search
+ * @tparam As the tag of the result column
+ */
+template <StringLiteral Tag, StringLiteral As = Tag>
+using MaxOf = ExtremumOf<Tag, As, std::greater<>>;
+
+/**
+ * @brief The state of MeanOf, the sum and number of the values seen so far
+ */
+struct MeanState {
+  double total{};
+  std::size_t count{};
+};
+
+/**
+ * @brief An aggregate averaging the arithmetic column named Tag as double into the result column
+ * named As, zero if no row was selected
+ * @tparam Tag the tag of the column to average
+ * @tparam As the tag of the result column
+ */
+template <StringLiteral Tag, StringLiteral As = Tag>
+struct MeanOf {
+  static constexpr auto kName{As};
+
+  template <typename Columns>
+  using State = MeanState;
+
+  template <typename Columns>
+  static void accumulate(std::span<MeanState> states, const Columns& columns, std::size_t begin,
+                         std::span<const std::uint32_t> rows,
+                         std::span<const std::uint32_t> groups) {
+    const auto column = columns.template column<Tag>().subspan(begin);
+    if (groups.empty()) {
+      double total{};
+      for (const std::uint32_t row : rows) { total += static_cast<double>(column[row]); }
+      states.front().total += total;
+      states.front().count += rows.size();
+      return;
+    }
+    for (std::size_t index{0}; index < rows.size(); ++index) {
+      auto& state = states[groups[index]];
+      state.total += static_cast<double>(column[rows[index]]);
+      ++state.count;
+    }
+  }
+
+  static void merge(MeanState& into, const MeanState& from) {
+    into.total += from.total;
+    into.count += from.count;
+  }
+
+  [[nodiscard]] static double result(const MeanState& state) {
+    return state.count == 0 ? 0.0 : state.total / static_cast<double>(state.count);
+  }
+};
+
+/**
+ * @brief An aggregate counting the selected rows into the result column named As
+ * @tparam As the tag of the result column
+ */
+template <StringLiteral As = "count">
+struct CountOf {
+  static constexpr auto kName{As};
+
+  template <typename Columns>
+  using State = std::size_t;
+
+  template <typename Columns>
+  static void accumulate(std::span<std::size_t> states, const Columns& /*columns*/,
+                         std::size_t /*begin*/, std::span<const std::uint32_t> rows,
+                         std::span<const std::uint32_t> groups) {
+    if (groups.empty()) {
+      states.front() += rows.size();
+      return;
+    }
+    for (const std::uint32_t group : groups) { ++states[group]; }
+  }
+
+  static void merge(std::size_t& into, std::size_t from) { into += from; }
+
+  [[nodiscard]] static std::size_t result(std::size_t state) { return state; }
+};
+
+/**
+ * @brief An instance of SumOf for the given tags
+ * @tparam Tag the tag of the column to sum
+ * @tparam As the tag of the result column
+ */
+template <StringLiteral Tag, StringLiteral As = Tag>
+inline constexpr SumOf<Tag, As> sum_of{};
+
+/**
+ * @brief An instance of MinOf for the given tags
+ * @tparam Tag the tag of the column to search
+ * @tparam As the tag of the result column
+ */
+template <StringLiteral Tag, StringLiteral As = Tag>
+inline constexpr MinOf<Tag, As> min_of{};
+
+/**
+ * @brief An instance of MaxOf for the given tags
+ * @tparam Tag the tag of the column to search
+ * @tparam As the tag of the result column
+ */
+template <StringLiteral Tag, StringLiteral As = Tag>
+inline constexpr MaxOf<Tag, As> max_of{};
+
+/**
+ * @brief An instance of MeanOf for the given tags
+ * @tparam Tag the tag of the column to average
+ * @tparam As the tag of the result column
+ */
+template <StringLiteral Tag, StringLiteral As = Tag>
+inline constexpr MeanOf<Tag, As> mean_of{};
+
+/**
+ * @brief An instance of CountOf writing the result column named "count"
+ */
+inline constexpr CountOf<> count_of{};
+
+template <typename Source, StringLiteral... Tags>
+class GroupedQuery;
+
+/**
+ * @brief A query over a NamedTupleColumns, built with scan and refined with where
+ *
+ * The rows are evaluated in chunks of kQueryChunkRows: the filters narrow a selection vector of the
+ * chunk one after the other and the result is computed from the selected rows column by column.
+ * With more than one thread, the threads claim chunks from a shared counter until none are left, so
+ * a thread that finishes its chunks early takes over the remaining work, and their partial results
+ * are merged at the end. The query refers to the container, which must outlive it and must not be
+ * modified while the query runs.
+ *
+ * If a filter throws on any thread, the threads stop claiming chunks and the first exception is
+ * rethrown on the calling thread once every thread has finished.
+ *
+ * @tparam Columns type of NamedTupleColumns
+ * @tparam Filters types of Where filters
+ */
+template <typename Columns, typename... Filters>
+class Query {
+public:
+  using Container = Columns;
+
+  /**
+   * @brief Construct a query over a container
+   * @param columns container to query
+   * @param filters filters the rows must satisfy
+   * @param threads number of threads to evaluate the query on
+   */
+  constexpr Query(const Columns& columns, std::tuple<Filters...> filters, std::size_t threads)
+      : m_columns{&columns}, m_filters{std::move(filters)}, m_threads{threads} {}
+
+  /**
+   * @brief Add a filter on the column named Tag
+   * @tparam Tag the tag of the column to test
+   * @tparam Predicate type of predicate
+   * @param predicate predicate called with the values of the column named Tag
+   * @return a query selecting the rows of this query that also satisfy predicate
+   */
+  template <StringLiteral Tag, typename Predicate>
+  [[nodiscard]] Query<Columns, Filters..., Where<Tag, Predicate>> where(
+      Predicate predicate) const {
+    return {*m_columns,
+            std::tuple_cat(m_filters, std::tuple<Where<Tag, Predicate>>{{std::move(predicate)}}),
+            m_threads};
+  }
+
+  /**
+   * @brief Set the number of threads to evaluate the query on
+   * @param count number of threads, or 0 for one per hardware thread
+   * @return a copy of this query evaluated on count threads
+   */
+  [[nodiscard]] Query threads(std::size_t count) const {
+    Query result{*this};
+    result.m_threads = count == 0 ? std::max(1U, std::thread::hardware_concurrency()) : count;
+    return result;
+  }
+
+  /**
+   * @brief Group the selected rows by the columns named Tags
+   * @tparam Tags tags of the columns to group by
+   * @return a query to aggregate the groups with
+   */
+  template <StringLiteral... Tags>
+    requires(sizeof...(Tags) > 0)
+  [[nodiscard]] GroupedQuery<Query, Tags...> group_by() const {
+    return GroupedQuery<Query, Tags...>{*this};
+  }
+
+  /**
+   * @brief Count the selected rows
+   * @return the number of rows satisfying every filter
+   */
+  [[nodiscard]] std::size_t count() const {
+    return agg(CountOf<>{}).template get<"count">();
+  }
+
+  /**
+   * @brief Copy the selected rows
+   * @return a container of the rows satisfying every filter, in their original order
+   */
+  [[nodiscard]] Columns collect() const {
+    std::vector<std::vector<std::uint32_t>> selections(chunk_count());
+    for_each_selection(worker_count(), [&selections](std::size_t /*worker*/, std::size_t chunk,
+                                                     std::size_t /*begin*/,
+                                                     std::span<const std::uint32_t> rows) {
+      selections[chunk].assign(rows.begin(), rows.end());
+    });
+    std::size_t total{0};
+    for (const auto& selection : selections) { total += selection.size(); }
+
+    Columns result;
+    result.resize(total);
+    [this, &result, &selections]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+      (
+          [&selections](auto source, auto target) {
+            std::size_t position{0};
+            for (std::size_t chunk{0}; chunk < selections.size(); ++chunk) {
+              const auto slice = source.subspan(chunk * kQueryChunkRows);
+              for (const std::uint32_t row : selections[chunk]) {
+                target[position++] = slice[row];
+              }
+            }
+          }(m_columns->template column<Indices>(), result.template column<Indices>()),
+          ...);
+    }(std::make_index_sequence<Columns::column_count()>{});
+    return result;
+  }
+
+  /**
+   * @brief Aggregate all selected rows
+   * @tparam Aggregates types of aggregates, such as SumOf or CountOf
+   * @return a NamedTuple holding the result of every aggregate under its result tag
+   */
+  template <typename... Aggregates>
+    requires(sizeof...(Aggregates) > 0)
+  [[nodiscard]] auto agg(Aggregates... /*aggregates*/) const {
+    using Result =
+        NamedTuple<NamedType<Aggregates::kName, AggregateResultT<Aggregates, Columns>>...>;
+    using States = std::tuple<AggregateStateT<Aggregates, Columns>...>;
+
+    std::vector<States> partials(worker_count());
+    for_each_selection(partials.size(), [this, &partials](std::size_t worker, std::size_t /*chunk*/,
+                                                          std::size_t begin,
+                                                          std::span<const std::uint32_t> rows) {
+      [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        (Aggregates::accumulate(std::span{&std::get<Indices>(partials[worker]), 1}, *m_columns,
+                                begin, rows, {}),
+         ...);
+      }(std::index_sequence_for<Aggregates...>{});
+    });
+    return [&partials]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+      auto& merged = partials.front();
+      for (std::size_t worker{1}; worker < partials.size(); ++worker) {
+        (Aggregates::merge(std::get<Indices>(merged), std::get<Indices>(partials[worker])), ...);
+      }
+      return Result{Aggregates::result(std::get<Indices>(merged))...};
+    }(std::index_sequence_for<Aggregates...>{});
+  }
+
+private:
+  template <typename, StringLiteral...>
+  friend class GroupedQuery;
+
+  [[nodiscard]] std::size_t chunk_count() const {
+    return (m_columns->size() + kQueryChunkRows - 1) / kQueryChunkRows;
+  }
+
+  [[nodiscard]] std::size_t worker_count() const {
+    return std::max(std::size_t{1}, std::min(m_threads, chunk_count()));
+  }
+
+  [[nodiscard]] std::size_t select(std::size_t begin, std::size_t length,
+                                   std::span<std::uint32_t, kQueryChunkRows> rows) const {
+    if constexpr (sizeof...(Filters) == 0) {
+      std::iota(rows.begin(), rows.begin() + static_cast<std::ptrdiff_t>(length), 0U);
+      return length;
+    } else {
+      return std::apply(
+          [this, begin, length, rows](const auto& first, const auto&... rest) {
+            std::size_t count{first.select_dense(*m_columns, begin, length, rows)};
+            ((count = rest.select_sparse(*m_columns, begin, rows.first(count))), ...);
+            return count;
+          },
+          m_filters);
+    }
+  }
+
+  // calls body(worker, chunk, begin, rows) with the selected rows of every chunk, where worker
+  // identifies the calling thread and is below workers. The first exception thrown by a filter or
+  // by body on any thread stops the remaining chunks and is rethrown once the helpers have joined
+  template <typename Body>
+  void for_each_selection(std::size_t workers, const Body& body) const {
+    const std::size_t size{m_columns->size()};
+    const std::size_t chunks{chunk_count()};
+    std::atomic<std::size_t> next{0};
+    std::mutex failure_mutex;
+    std::exception_ptr failure;
+    const auto run = [this, &body, &next, &failure_mutex, &failure, size,
+                      chunks](std::size_t worker) {
+      try {
+        std::array<std::uint32_t, kQueryChunkRows> rows;
+        for (std::size_t chunk{next.fetch_add(1, std::memory_order_relaxed)}; chunk < chunks;
+             chunk = next.fetch_add(1, std::memory_order_relaxed)) {
+          const std::size_t begin{chunk * kQueryChunkRows};
+          const std::size_t count{select(begin, std::min(kQueryChunkRows, size - begin), rows)};
+          body(worker, chunk, begin, std::span<const std::uint32_t>{rows.data(), count});
+        }
+      } catch (...) {
+        next.store(chunks, std::memory_order_relaxed);
+        const std::scoped_lock lock{failure_mutex};
+        if (!failure) { failure = std::current_exception(); }
+      }
+    };
+    {
+      std::vector<std::jthread> helpers;
+      helpers.reserve(workers - 1);
+      for (std::size_t worker{1}; worker < workers; ++worker) { helpers.emplace_back(run, worker); }
+      run(0);
+    }
+    if (failure) { std::rethrow_exception(failure); }
+  }
+
+  const Columns* m_columns;
+  std::tuple<Filters...> m_filters;
+  std::size_t m_threads;
+};
+
+/**
+ * @brief An open addressing hash table numbering the distinct keys made of the elements named Tags
+ * of NamedTuple like objects, in the order they are first added
+ *
+ * The table is searched with the objects themselves through HashBy and EqualBy, so a key is only
+ * copied out of an object the first time it is seen.
+ *
+ * @tparam Key type of NamedTuple holding the key elements
+ * @tparam Tags tags of the key elements
+ */
+template <typename Key, StringLiteral... Tags>
+class GroupIndex {
+public:
+  /**
+   * @brief Find the number of the key of an object, adding the key if it is not in the table
+   * @tparam Object type of NamedTuple like object
+   * @param object object holding the key elements
+   * @return the number of the key and whether it was added
+   */
+  template <typename Object>
+  std::pair<std::uint32_t, bool> find_or_add(const Object& object) {
+    if (2 * (m_keys.size() + 1) > m_slots.size()) { grow(); }
+    const std::size_t hash{hash_by<Tags...>(object)};
+    const std::size_t mask{m_slots.size() - 1};
+    for (std::size_t slot{hash & mask};; slot = (slot + 1) & mask) {
+      const std::uint32_t group{m_slots[slot]};
+      if (group == kEmpty) {
+        m_keys.emplace_back(object.template get<Tags>()...);
+        m_hashes.push_back(hash);
+        m_slots[slot] = static_cast<std::uint32_t>(m_keys.size() - 1);
+        return {m_slots[slot], true};
+      }
+      if (m_hashes[group] == hash && equal_by<Tags...>(m_keys[group], object)) {
+        return {group, false};
+      }
+    }
+  }
+
+  /**
+   * @brief Get the keys in the table
+   * @return the keys, indexed by their number
+   */
+  [[nodiscard]] const std::vector<Key>& keys() const noexcept { return m_keys; }
+
+private:
+  static constexpr std::uint32_t kEmpty{std::numeric_limits<std::uint32_t>::max()};
+  static constexpr std::size_t kInitialSlots{64};
+
+  void grow() {
+    m_slots.assign(std::max(kInitialSlots, 2 * m_slots.size()), kEmpty);
+    const std::size_t mask{m_slots.size() - 1};
+    for (std::size_t group{0}; group < m_hashes.size(); ++group) {
+      std::size_t slot{m_hashes[group] & mask};
+      while (m_slots[slot] != kEmpty) { slot = (slot + 1) & mask; }
+      m_slots[slot] = static_cast<std::uint32_t>(group);
+    }
+  }
+
+  std::vector<std::uint32_t> m_slots{};
+  std::vector<std::size_t> m_hashes{};
+  std::vector<Key> m_keys{};
+};
+
+/**
+ * @brief A query whose selected rows are grouped by the columns named Tags
+ *
+ * Every thread maps the group keys of its chunks to dense group numbers through a GroupIndex, so
+ * the aggregates update arrays of states indexed by group, and the tables of the threads are merged
+ * at the end. Groups appear in the result in the order they were first seen, which is the order of
+ * the rows when the query runs on one thread and unspecified otherwise.
+ *
+ * @tparam Source type of the query whose rows are grouped
+ * @tparam Tags tags of the columns to group by
+ */
+template <typename Source, StringLiteral... Tags>
+class GroupedQuery {
+public:
+  using Columns = typename Source::Container;
+  using Key = NamedTuple<NamedType<Tags, ColumnValueT<Tags, Columns>>...>;
+
+  /**
+   * @brief Construct a grouped query
+   * @param query query whose rows are grouped
+   */
+  constexpr explicit GroupedQuery(Source query) : m_query{std::move(query)} {}
+
+  /**
+   * @brief Aggregate the selected rows of every group
+   * @tparam Aggregates types of aggregates, such as SumOf or CountOf
+   * @return a container with one row per group holding the columns named Tags followed by the
+   * result of every aggregate under its result tag
+   */
+  template <typename... Aggregates>
+    requires(sizeof...(Aggregates) > 0)
+  [[nodiscard]] auto agg(Aggregates... /*aggregates*/) const {
+    using Result = NamedTupleColumns<
+        NamedType<Tags, ColumnValueT<Tags, Columns>>...,
+        NamedType<Aggregates::kName, AggregateResultT<Aggregates, Columns>>...>;
+    struct Partial {
+      GroupIndex<Key, Tags...> index{};
+      std::tuple<std::vector<AggregateStateT<Aggregates, Columns>>...> states{};
+    };
+    const auto find_or_add = [](Partial& partial, const auto& object) {
+      const auto [group, added] = partial.index.find_or_add(object);
+      if (added) {
+        std::apply([](auto&... states) { (states.emplace_back(), ...); }, partial.states);
+      }
+      return group;
+    };
+    constexpr auto kIndices = std::index_sequence_for<Aggregates...>{};
+
+    const Columns& columns{*m_query.m_columns};
+    std::vector<Partial> partials(m_query.worker_count());
+    const auto body = [&columns, &partials, &find_or_add](
+                          std::size_t worker, std::size_t /*chunk*/, std::size_t begin,
+                          std::span<const std::uint32_t> rows) {
+      auto& partial = partials[worker];
+      std::array<std::uint32_t, kQueryChunkRows> groups;
+      for (std::size_t index{0}; index < rows.size(); ++index) {
+        groups[index] = find_or_add(partial, columns[begin + rows[index]]);
+      }
+      [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        (Aggregates::accumulate(std::span{std::get<Indices>(partial.states)}, columns, begin, rows,
+                                std::span<const std::uint32_t>{groups.data(), rows.size()}),
+         ...);
+      }(std::index_sequence_for<Aggregates...>{});
+    };
+    m_query.for_each_selection(partials.size(), body);
+
+    auto& merged = partials.front();
+    for (std::size_t worker{1}; worker < partials.size(); ++worker) {
+      const auto& partial = partials[worker];
+      for (std::size_t group{0}; group < partial.index.keys().size(); ++group) {
+        const std::uint32_t into{find_or_add(merged, partial.index.keys()[group])};
+        [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+          (Aggregates::merge(std::get<Indices>(merged.states)[into],
+                             std::get<Indices>(partial.states)[group]),
+           ...);
+        }(kIndices);
+      }
+    }
+
+    const auto& keys = merged.index.keys();
+    Result result;
+    result.resize(keys.size());
+    for (std::size_t group{0}; group < keys.size(); ++group) {
+      ((result.template column<Tags>()[group] = keys[group].template get<Tags>()), ...);
+      [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        ((result.template column<Aggregates::kName>()[group] =
+              Aggregates::result(std::get<Indices>(merged.states)[group])),
+         ...);
+      }(kIndices);
+    }
+    return result;
+  }
+
+private:
+  Source m_query;
+};
+
+/**
+ * @brief Start a query over a NamedTupleColumns
+ * @tparam NamedTypes pack of NamedType in the NamedTupleColumns
+ * @param columns container to query, which must outlive the query
+ * @return a query selecting every row, evaluated on one thread
+ */
+template <typename... NamedTypes>
+[[nodiscard]] Query<NamedTupleColumns<NamedTypes...>> scan(
+    const NamedTupleColumns<NamedTypes...>& columns) {
+  return {columns, {}, 1};
+}
+
+/**
+ * @brief Deleted overload preventing a query from referring to a temporary container
+ */
+template <typename... NamedTypes>
+void scan(const NamedTupleColumns<NamedTypes...>&& columns) = delete;
+}  // namespace mguid
+
+#endif  // MGUID_NAMEDTUPLEQUERY_H
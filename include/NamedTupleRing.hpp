@@ -0,0 +1,430 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+
+#ifndef MGUID_NAMEDTUPLERING_H
+#define MGUID_NAMEDTUPLERING_H
+
+#include "NamedTupleTranspose.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace mguid {
+
+/**
+ * @brief Whether every element of a NamedTuple is trivially copyable, so a NamedTuple can be kept
+ * constructed in a slot and copied in and out by plain assignment
+ * @tparam NT a NamedTuple type
+ */
+template <typename NT>
+inline constexpr bool plain_slots_v = std::invoke(
+    []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+      return std::is_default_constructible_v<NT> &&
+             (std::is_trivially_copyable_v<std::tuple_element_t<Indices, typename NT::Base>> &&
+              ...);
+    },
+    std::make_index_sequence<std::tuple_size_v<NT>>{});
+
+/**
+ * @brief Uninitialized storage for a NamedTuple in a ring slot
+ * @tparam NT a NamedTuple type
+ */
+template <typename NT>
+struct RawSlot {
+  alignas(NT) std::byte storage[sizeof(NT)];
+};
+
+/**
+ * @brief A bounded lock-free ring whose slots hold NamedTuples directly
+ *
+ * The single producer single consumer ring keeps the consumer index and the producer index on
+ * separate cache lines, each next to a cached copy of the other index, so an uncontended push or
+ * pop touches no cache line written by the other side. The multi producer multi consumer ring
+ * gives every slot a sequence number, after Dmitry Vyukov's bounded queue.
+ *
+ * When every element is trivially copyable the slots hold constructed NamedTuples that are copied
+ * in and out by plain assignment; otherwise records are constructed in place in the slot and
+ * destroyed when they are popped.
+ *
+ * A producer whose record throws while being constructed leaves the ring unchanged. In the multi
+ * producer ring the claimed slot is published as empty instead, and consumers skip it. If moving a
+ * record out throws, the single consumer ring keeps the record, and pop_n pops only the records
+ * moved out before it. The multi consumer ring destroys it and releases the slot, so other
+ * consumers don't stall on it.
+ *
+ * @tparam Multi true for multiple producers and consumers, false for one of each
+ * @tparam NT a NamedTuple type
+ * @tparam Capacity number of slots, a power of two
+ */
+template <bool Multi, typename NT, std::size_t Capacity>
+  requires(is_named_tuple_v<NT> && Capacity > 0 && std::has_single_bit(Capacity))
+class BasicNamedTupleRing {
+  static constexpr std::size_t kMask{Capacity - 1};
+  static constexpr bool kPlain{plain_slots_v<NT>};
+
+  using Slot = std::conditional_t<kPlain, NT, RawSlot<NT>>;
+
+  struct SequencedSlot {
+    std::atomic<std::size_t> sequence{0};
+    bool filled{false};
+    Slot slot{};
+  };
+
+  using Cell = std::conditional_t<Multi, SequencedSlot, Slot>;
+
+public:
+  using value_type = NT;
+
+  /**
+   * @brief Construct an empty ring
+   */
+  BasicNamedTupleRing() noexcept {
+    if constexpr (Multi) {
+      for (std::size_t index{0}; index < Capacity; ++index) {
+        m_cells[index].sequence.store(index, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  BasicNamedTupleRing(const BasicNamedTupleRing&) = delete;
+  BasicNamedTupleRing& operator=(const BasicNamedTupleRing&) = delete;
+
+  /**
+   * @brief Destroy the records left in the ring
+   */
+  ~BasicNamedTupleRing() {
+    if constexpr (!kPlain) {
+      while (try_pop()) {}
+    }
+  }
+
+  /**
+   * @brief Get the number of slots in the ring
+   * @return Capacity
+   */
+  [[nodiscard]] static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+  /**
+   * @brief Get the number of records in the ring, only a snapshot while the ring is in use
+   * @return the number of records in the ring
+   */
+  [[nodiscard]] std::size_t size() const noexcept {
+    const std::size_t head{m_head.load(std::memory_order_acquire)};
+    const std::size_t tail{m_tail.load(std::memory_order_acquire)};
+    return tail - std::min(head, tail);
+  }
+
+  /**
+   * @brief Check whether the ring is empty, only a snapshot while the ring is in use
+   * @return true if the ring holds no records; otherwise false
+   */
+  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+  /**
+   * @brief Construct a record in the next free slot
+   *
+   * The arguments are passed to a constructor of NT, so both positional values and NamedTypeV
+   * values in any order are accepted.
+   *
+   * @tparam Args types of the constructor arguments
+   * @param args arguments to construct the record from
+   * @return true if the record was pushed; false if the ring is full
+   */
+  template <typename... Args>
+    requires(std::is_constructible_v<NT, Args...>)
+  bool try_emplace(Args&&... args) {
+    if constexpr (Multi) {
+      std::size_t tail{m_tail.load(std::memory_order_relaxed)};
+      SequencedSlot* cell;
+      for (;;) {
+        cell = &m_cells[tail & kMask];
+        const std::size_t sequence{cell->sequence.load(std::memory_order_acquire)};
+        const auto distance = static_cast<std::ptrdiff_t>(sequence - tail);
+        if (distance == 0) {
+          if (m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) { break; }
+        } else if (distance < 0) {
+          return false;
+        } else {
+          tail = m_tail.load(std::memory_order_relaxed);
+        }
+      }
+      try {
+        construct(cell->slot, std::forward<Args>(args)...);
+      } catch (...) {
+        // the slot is already claimed, publish it empty so consumers skip it
+        cell->filled = false;
+        cell->sequence.store(tail + 1, std::memory_order_release);
+        throw;
+      }
+      cell->filled = true;
+      cell->sequence.store(tail + 1, std::memory_order_release);
+    } else {
+      const std::size_t tail{m_tail.load(std::memory_order_relaxed)};
+      if (tail - m_cached_head == Capacity) {
+        m_cached_head = m_head.load(std::memory_order_acquire);
+        if (tail - m_cached_head == Capacity) { return false; }
+      }
+      construct(m_cells[tail & kMask], std::forward<Args>(args)...);
+      m_tail.store(tail + 1, std::memory_order_release);
+    }
+    return true;
+  }
+
+  /**
+   * @brief Copy a record into the next free slot
+   * @param record record to push
+   * @return true if the record was pushed; false if the ring is full
+   */
+  bool try_push(const NT& record) { return try_emplace(record); }
+
+  /**
+   * @brief Move a record into the next free slot
+   * @param record record to push
+   * @return true if the record was pushed; false if the ring is full
+   */
+  bool try_push(NT&& record) { return try_emplace(std::move(record)); }
+
+  /**
+   * @brief Pop the oldest record
+   * @param out NamedTuple to move the record into
+   * @return true if a record was popped; false if the ring is empty
+   */
+  bool try_pop(NT& out) {
+    return pop_with([&out](NT& record) { out = std::move(record); });
+  }
+
+  /**
+   * @brief Pop the oldest record
+   * @return the record if the ring was not empty; otherwise std::nullopt
+   */
+  std::optional<NT> try_pop() {
+    std::optional<NT> result;
+    pop_with([&result](NT& record) { result.emplace(std::move(record)); });
+    return result;
+  }
+
+  /**
+   * @brief Pop up to out.size() of the oldest records
+   *
+   * The single consumer ring claims every available record with a single store of its index, the
+   * multi consumer ring pops them one at a time.
+   *
+   * @param out span to move the records into
+   * @return the number of records popped
+   */
+  std::size_t pop_n(std::span<NT> out) {
+    if constexpr (Multi) {
+      std::size_t count{0};
+      while (count < out.size() && try_pop(out[count])) { ++count; }
+      return count;
+    } else {
+      return pop_batch(out.size(), [&out](Slot* first, std::size_t count, std::size_t& handed) {
+        for (std::size_t index{0}; index < count; ++index, ++handed) {
+          out[handed] = std::move(value(first[index]));
+        }
+      });
+    }
+  }
+
+  /**
+   * @brief Pop up to limit of the oldest records and append them to a NamedTupleColumns
+   *
+   * With plain slots the single consumer ring transposes the slots straight into the columns.
+   *
+   * @tparam NamedTypes pack of NamedType in NT
+   * @param columns container to append the records to
+   * @param limit maximum number of records to pop
+   * @return the number of records popped
+   */
+  template <typename... NamedTypes>
+    requires(std::is_same_v<NT, NamedTuple<NamedTypes...>>)
+  std::size_t pop_n(NamedTupleColumns<NamedTypes...>& columns, std::size_t limit) {
+    if constexpr (Multi) {
+      std::size_t count{0};
+      while (count < limit &&
+             pop_with([&columns](NT& record) { columns.push_back(std::move(record)); })) {
+        ++count;
+      }
+      return count;
+    } else {
+      return pop_batch(limit, [&columns](Slot* first, std::size_t count, std::size_t& handed) {
+        if constexpr (kPlain) {
+          to_columns(std::span<const NT>{first, count}, columns);
+          handed += count;
+        } else {
+          for (std::size_t index{0}; index < count; ++index, ++handed) {
+            columns.push_back(std::move(value(first[index])));
+          }
+        }
+      });
+    }
+  }
+
+private:
+  template <typename... Args>
+  static void construct(Slot& slot, Args&&... args) {
+    if constexpr (kPlain) {
+      if constexpr (sizeof...(Args) == 1 &&
+                    (std::is_same_v<std::remove_cvref_t<Args>, NT> && ...)) {
+        slot = (std::forward<Args>(args), ...);
+      } else {
+        slot = NT(std::forward<Args>(args)...);
+      }
+    } else {
+      ::new (static_cast<void*>(slot.storage)) NT(std::forward<Args>(args)...);
+    }
+  }
+
+  static NT& value(Slot& slot) noexcept {
+    if constexpr (kPlain) {
+      return slot;
+    } else {
+      return *std::launder(reinterpret_cast<NT*>(slot.storage));
+    }
+  }
+
+  static void destroy(Slot& slot) noexcept {
+    if constexpr (!kPlain) { std::destroy_at(&value(slot)); }
+  }
+
+  template <typename Consumer>
+  bool pop_with(Consumer&& consumer) {
+    if constexpr (Multi) {
+      std::size_t head{m_head.load(std::memory_order_relaxed)};
+      SequencedSlot* cell;
+      for (;;) {
+        cell = &m_cells[head & kMask];
+        const std::size_t sequence{cell->sequence.load(std::memory_order_acquire)};
+        const auto distance = static_cast<std::ptrdiff_t>(sequence - (head + 1));
+        if (distance == 0) {
+          if (m_head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed)) {
+            if (cell->filled) { break; }
+            // the producer of this slot threw while constructing its record
+            cell->sequence.store(head + Capacity, std::memory_order_release);
+            head = m_head.load(std::memory_order_relaxed);
+          }
+        } else if (distance < 0) {
+          return false;
+        } else {
+          head = m_head.load(std::memory_order_relaxed);
+        }
+      }
+      try {
+        consumer(value(cell->slot));
+      } catch (...) {
+        destroy(cell->slot);
+        cell->sequence.store(head + Capacity, std::memory_order_release);
+        throw;
+      }
+      destroy(cell->slot);
+      cell->sequence.store(head + Capacity, std::memory_order_release);
+    } else {
+      const std::size_t head{m_head.load(std::memory_order_relaxed)};
+      if (head == m_cached_tail) {
+        m_cached_tail = m_tail.load(std::memory_order_acquire);
+        if (head == m_cached_tail) { return false; }
+      }
+      consumer(value(m_cells[head & kMask]));
+      destroy(m_cells[head & kMask]);
+      m_head.store(head + 1, std::memory_order_release);
+    }
+    return true;
+  }
+
+  // hands the available records to consumer as at most two contiguous runs of slots, consumer
+  // counts the records it has taken in handed so that a throw pops only those
+  template <typename Consumer>
+  std::size_t pop_batch(std::size_t limit, Consumer&& consumer) {
+    const std::size_t head{m_head.load(std::memory_order_relaxed)};
+    if (m_cached_tail - head < limit) { m_cached_tail = m_tail.load(std::memory_order_acquire); }
+    const std::size_t count{std::min(limit, m_cached_tail - head)};
+    if (count == 0) { return 0; }
+
+    const std::size_t first{head & kMask};
+    const std::size_t run{std::min(count, Capacity - first)};
+    std::size_t handed{0};
+    try {
+      consumer(&m_cells[first], run, handed);
+      if (run < count) { consumer(&m_cells[0], count - run, handed); }
+    } catch (...) {
+      release(head, handed);
+      throw;
+    }
+    release(head, count);
+    return count;
+  }
+
+  void release(std::size_t head, std::size_t count) noexcept {
+    for (std::size_t index{0}; index < count; ++index) { destroy(m_cells[(head + index) & kMask]); }
+    m_head.store(head + count, std::memory_order_release);
+  }
+
+  // consumer side: the index of the next record to pop and the last tail it has seen
+  alignas(kCacheLineSize) std::atomic<std::size_t> m_head{0};
+  std::size_t m_cached_tail{0};
+
+  // producer side: the index of the next slot to fill and the last head it has seen
+  alignas(kCacheLineSize) std::atomic<std::size_t> m_tail{0};
+  std::size_t m_cached_head{0};
+
+  alignas(kCacheLineSize) std::array<Cell, Capacity> m_cells;
+};
+
+/**
+ * @brief A single producer single consumer lock-free ring of NamedTuples
+ * @tparam NT a NamedTuple type
+ * @tparam Capacity number of slots, a power of two
+ */
+template <typename NT, std::size_t Capacity>
+using NamedTupleRing = BasicNamedTupleRing<false, NT, Capacity>;
+
+/**
+ * @brief A multi producer multi consumer lock-free ring of NamedTuples
+ * @tparam NT a NamedTuple type
+ * @tparam Capacity number of slots, a power of two
+ */
+template <typename NT, std::size_t Capacity>
+using MpmcNamedTupleRing = BasicNamedTupleRing<true, NT, Capacity>;
+
+}  // namespace mguid
+
+#endif  // MGUID_NAMEDTUPLERING_H
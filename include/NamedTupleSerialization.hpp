@@ -0,0 +1,271 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+#ifndef MGUID_NAMEDTUPLESERIALIZATION_H
+#define MGUID_NAMEDTUPLESERIALIZATION_H
+
+#include "NamedTuple.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace mguid {
+
+/**
+ * @brief Determine whether a type can be written to and read from a buffer by copying its bytes
+ * @tparam Type type to check
+ */
+template <typename Type>
+concept TriviallySerializable = std::is_object_v<Type> && std::is_trivially_copyable_v<Type> &&
+                                !std::is_pointer_v<Type> && !std::is_member_pointer_v<Type>;
+
+/**
+ * @brief Base template of the binary layout of a NamedTuple
+ * @tparam NT unconstrained type
+ */
+template <typename NT>
+struct BinaryLayout;
+
+/**
+ * @brief The binary layout of a NamedTuple whose elements are all trivially copyable
+ *
+ * A serialized record is a 64-bit fingerprint followed by every element in declared order with no
+ * padding. The fingerprint combines schema_hash_v with the byte order of the host, so buffers
+ * written with a different schema or on a host with a different byte order are rejected.
+ *
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ */
+template <typename... NamedTypes>
+  requires(TriviallySerializable<typename ExtractType<NamedTypes>::type> && ...)
+struct BinaryLayout<NamedTuple<NamedTypes...>> {
+  static constexpr std::size_t header_size{sizeof(std::uint64_t)};
+
+  static constexpr std::size_t size{
+      header_size + (std::size_t{0} + ... + sizeof(typename ExtractType<NamedTypes>::type))};
+
+  static constexpr std::array<std::size_t, sizeof...(NamedTypes)> offsets = [] {
+    std::array<std::size_t, sizeof...(NamedTypes)> result{};
+    std::size_t index{0};
+    std::size_t offset{header_size};
+    ((result[index++] = offset, offset += sizeof(typename ExtractType<NamedTypes>::type)), ...);
+    return result;
+  }();
+
+  static constexpr std::uint64_t fingerprint{
+      mix64(schema_hash_v<NamedTuple<NamedTypes...>> ^
+            (std::endian::native == std::endian::little ? 1ULL : 2ULL))};
+};
+
+/**
+ * @brief Determine whether a type is a NamedTuple that has a binary layout
+ * @tparam NT type to check
+ */
+template <typename NT>
+concept BinarySerializable = requires { BinaryLayout<NT>::size; };
+
+/**
+ * @brief The number of bytes needed to serialize a NamedTuple of type NT
+ * @tparam NT a NamedTuple whose elements are all trivially copyable
+ */
+template <BinarySerializable NT>
+inline constexpr std::size_t serialized_size_v{BinaryLayout<NT>::size};
+
+/**
+ * @brief Read the schema fingerprint stored at the beginning of a serialized record
+ * @param buffer buffer holding a serialized record
+ * @return the stored fingerprint if the buffer is large enough to hold one; otherwise std::nullopt
+ */
+[[nodiscard]] inline std::optional<std::uint64_t> read_fingerprint(
+    std::span<const std::byte> buffer) noexcept {
+  if (buffer.size() < sizeof(std::uint64_t)) { return std::nullopt; }
+  std::uint64_t fingerprint{};
+  std::memcpy(&fingerprint, buffer.data(), sizeof(fingerprint));
+  return fingerprint;
+}
+
+/**
+ * @brief Serialize a NamedTuple into a buffer
+ *
+ * Every element is written with a fixed size memcpy to an offset known at compile time, which the
+ * compiler lowers to plain loads and stores.
+ *
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ * @param nt NamedTuple to serialize
+ * @param buffer buffer to write into, at least serialized_size_v bytes long
+ * @return the number of bytes written, or 0 if the buffer is too small
+ */
+template <typename... NamedTypes>
+  requires(TriviallySerializable<typename ExtractType<NamedTypes>::type> && ...)
+std::size_t serialize(const NamedTuple<NamedTypes...>& nt, std::span<std::byte> buffer) noexcept {
+  using Layout = BinaryLayout<NamedTuple<NamedTypes...>>;
+  if (buffer.size() < Layout::size) { return 0; }
+
+  std::memcpy(buffer.data(), &Layout::fingerprint, sizeof(Layout::fingerprint));
+  [&nt, &buffer]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+    (std::memcpy(buffer.data() + Layout::offsets[Indices], &nt.template get<Indices>(),
+                 sizeof(std::tuple_element_t<Indices, NamedTuple<NamedTypes...>>)),
+     ...);
+  }(std::index_sequence_for<NamedTypes...>{});
+  return Layout::size;
+}
+
+/**
+ * @brief Deserialize a buffer into an existing NamedTuple
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ * @param buffer buffer holding a record serialized by serialize
+ * @param nt NamedTuple to overwrite
+ * @return true if the buffer held a record with a matching fingerprint; otherwise false and nt is
+ * left unchanged
+ */
+template <typename... NamedTypes>
+  requires(TriviallySerializable<typename ExtractType<NamedTypes>::type> && ...)
+bool deserialize(std::span<const std::byte> buffer, NamedTuple<NamedTypes...>& nt) noexcept {
+  using Layout = BinaryLayout<NamedTuple<NamedTypes...>>;
+  if (buffer.size() < Layout::size || read_fingerprint(buffer) != Layout::fingerprint) {
+    return false;
+  }
+
+  [&nt, &buffer]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+    (std::memcpy(&nt.template get<Indices>(), buffer.data() + Layout::offsets[Indices],
+                 sizeof(std::tuple_element_t<Indices, NamedTuple<NamedTypes...>>)),
+     ...);
+  }(std::index_sequence_for<NamedTypes...>{});
+  return true;
+}
+
+/**
+ * @brief Deserialize a buffer into a new NamedTuple
+ * @tparam NT type of NamedTuple to deserialize
+ * @param buffer buffer holding a record serialized by serialize
+ * @return the deserialized NamedTuple if the buffer held a record with a matching fingerprint;
+ * otherwise std::nullopt
+ */
+template <BinarySerializable NT>
+  requires(std::is_default_constructible_v<NT>)
+[[nodiscard]] std::optional<NT> deserialize(std::span<const std::byte> buffer) noexcept {
+  std::optional<NT> result{std::in_place};
+  if (!deserialize(buffer, *result)) { result.reset(); }
+  return result;
+}
+
+/**
+ * @brief Base template of a read only view of a serialized record
+ * @tparam NT unconstrained type
+ */
+template <typename NT>
+class BinaryView;
+
+/**
+ * @brief A read only view of a record serialized by serialize that reads elements straight from
+ * the buffer without deserializing the whole record
+ * @tparam NamedTypes pack of NamedType in the NamedTuple that was serialized
+ */
+template <typename... NamedTypes>
+  requires(TriviallySerializable<typename ExtractType<NamedTypes>::type> && ...)
+class BinaryView<NamedTuple<NamedTypes...>> {
+  using NT = NamedTuple<NamedTypes...>;
+  using Layout = BinaryLayout<NT>;
+
+public:
+  /**
+   * @brief Create a view over a buffer if it holds a record of type NT
+   * @param buffer buffer holding a record serialized by serialize
+   * @return a view over the record if the fingerprint matches; otherwise std::nullopt
+   */
+  [[nodiscard]] static std::optional<BinaryView> from(std::span<const std::byte> buffer) noexcept {
+    if (buffer.size() < Layout::size || read_fingerprint(buffer) != Layout::fingerprint) {
+      return std::nullopt;
+    }
+    return BinaryView{buffer.first(Layout::size)};
+  }
+
+  /**
+   * @brief Get the number of elements in the viewed record
+   * @return the number of elements in the viewed record
+   */
+  [[nodiscard]] constexpr std::size_t size() const noexcept { return std::tuple_size_v<NT>; }
+
+  /**
+   * @brief Get the bytes of the viewed record
+   * @return the bytes of the viewed record
+   */
+  [[nodiscard]] constexpr std::span<const std::byte> bytes() const noexcept { return m_buffer; }
+
+  /**
+   * @brief Read the element of the record whose index is Index
+   * @tparam Index index of the element to read
+   * @return a copy of the element
+   */
+  template <std::size_t Index>
+    requires(Index < std::tuple_size_v<NT>)
+  [[nodiscard]] std::tuple_element_t<Index, NT> get() const noexcept {
+    // read through bytes, since the element need not be default constructible
+    std::array<std::byte, sizeof(std::tuple_element_t<Index, NT>)> bytes;
+    std::memcpy(bytes.data(), m_buffer.data() + Layout::offsets[Index], bytes.size());
+    return std::bit_cast<std::tuple_element_t<Index, NT>>(bytes);
+  }
+
+  /**
+   * @brief Read the element of the record whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @return a copy of the element
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] auto get() const noexcept {
+    return get<key_index_v<Tag, NamedTypes...>>();
+  }
+
+  /**
+   * @brief Read every element of the record into a NamedTuple
+   * @return the deserialized NamedTuple
+   */
+  [[nodiscard]] NT to_tuple() const noexcept {
+    NT result{};
+    deserialize(m_buffer, result);
+    return result;
+  }
+
+private:
+  constexpr explicit BinaryView(std::span<const std::byte> buffer) noexcept : m_buffer{buffer} {}
+
+  std::span<const std::byte> m_buffer;
+};
+}  // namespace mguid
+
+#endif  // MGUID_NAMEDTUPLESERIALIZATION_H
@@ -0,0 +1,247 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+
+#ifndef MGUID_NAMEDTUPLETRANSPOSE_H
+#define MGUID_NAMEDTUPLETRANSPOSE_H
+
+#include "NamedTupleColumns.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace mguid {
+
+/**
+ * @brief Number of rows transposed per block
+ *
+ * Every column of a block is copied before moving on to the next block, so the rows of a block are
+ * read from cache instead of memory once per column.
+ */
+inline constexpr std::size_t kTransposeBlockRows{256};
+
+/**
+ * @brief Copy count objects placed stride bytes apart into a contiguous array
+ *
+ * With AVX2, 4 and 8 byte objects are loaded with hardware gathers of 8 and 4 objects at a time.
+ * AVX2 and NEON have no scatter, and NEON has no gather either; there the loop is left to the
+ * auto-vectorizer.
+ *
+ * @tparam Type trivially copyable type of the objects
+ * @param source address of the first object
+ * @param stride distance in bytes between consecutive objects
+ * @param destination array of at least count objects to copy into
+ * @param count number of objects to copy
+ */
+template <typename Type>
+  requires(std::is_trivially_copyable_v<Type>)
+void gather_strided(const std::byte* source, std::size_t stride, Type* destination,
+                    std::size_t count) noexcept {
+  std::size_t index{0};
+#if defined(__AVX2__)
+  if constexpr (sizeof(Type) == 4) {
+    if (stride <= static_cast<std::size_t>(std::numeric_limits<int>::max() / 8)) {
+      const auto step = static_cast<int>(stride);
+      const __m256i offsets = _mm256_setr_epi32(0, step, 2 * step, 3 * step, 4 * step, 5 * step,
+                                                6 * step, 7 * step);
+      for (; index + 8 <= count; index += 8) {
+        const __m256i values = _mm256_i32gather_epi32(
+            reinterpret_cast<const int*>(source + index * stride), offsets, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + index), values);
+      }
+    }
+  } else if constexpr (sizeof(Type) == 8) {
+    const auto step = static_cast<long long>(stride);
+    const __m256i offsets = _mm256_setr_epi64x(0, step, 2 * step, 3 * step);
+    for (; index + 4 <= count; index += 4) {
+      const __m256i values = _mm256_i64gather_epi64(
+          reinterpret_cast<const long long*>(source + index * stride), offsets, 1);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + index), values);
+    }
+  }
+#endif
+  for (; index < count; ++index) {
+    std::memcpy(destination + index, source + index * stride, sizeof(Type));
+  }
+}
+
+/**
+ * @brief Copy a contiguous array of count objects to places stride bytes apart
+ * @tparam Type trivially copyable type of the objects
+ * @param source array of at least count objects to copy from
+ * @param destination address of the first object to overwrite
+ * @param stride distance in bytes between consecutive objects to overwrite
+ * @param count number of objects to copy
+ */
+template <typename Type>
+  requires(std::is_trivially_copyable_v<Type>)
+void scatter_strided(const Type* source, std::byte* destination, std::size_t stride,
+                     std::size_t count) noexcept {
+  for (std::size_t index{0}; index < count; ++index) {
+    std::memcpy(destination + index * stride, source + index, sizeof(Type));
+  }
+}
+
+/**
+ * @brief Get the NamedTupleColumns type storing the rows of a NamedTuple
+ * @tparam NT a NamedTuple type
+ */
+template <typename NT>
+struct ColumnsOf;
+
+/**
+ * @brief Get the NamedTupleColumns type storing the rows of a NamedTuple
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ */
+template <typename... NamedTypes>
+struct ColumnsOf<NamedTuple<NamedTypes...>> {
+  using type = NamedTupleColumns<NamedTypes...>;
+};
+
+/**
+ * @brief Append contiguous rows to the columns of a NamedTupleColumns
+ *
+ * The rows are copied in blocks of kTransposeBlockRows, trivially copyable elements are gathered
+ * directly from the storage of the rows.
+ *
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ * @param rows rows to transpose
+ * @param columns container to append the rows to
+ */
+template <typename... NamedTypes>
+void to_columns(std::span<const NamedTuple<NamedTypes...>> rows,
+                NamedTupleColumns<NamedTypes...>& columns) {
+  using NT = NamedTuple<NamedTypes...>;
+  const std::size_t first{columns.size()};
+  columns.resize(first + rows.size());
+
+  for (std::size_t block{0}; block < rows.size(); block += kTransposeBlockRows) {
+    const auto count = std::min(kTransposeBlockRows, rows.size() - block);
+    [&rows, &columns, first, block, count]<std::size_t... Indices>(
+        std::index_sequence<Indices...>) {
+      (
+          [&rows, &columns, first, block, count]<std::size_t Index>() {
+            using Type = std::tuple_element_t<Index, typename NT::Base>;
+            auto column = columns.template column<Index>().subspan(first + block, count);
+            if constexpr (std::is_trivially_copyable_v<Type>) {
+              gather_strided(
+                  reinterpret_cast<const std::byte*>(&rows[block].template get<Index>()),
+                  sizeof(NT), column.data(), count);
+            } else {
+              std::ranges::transform(rows.subspan(block, count), column.begin(),
+                                     [](const NT& row) { return row.template get<Index>(); });
+            }
+          }.template operator()<Indices>(),
+          ...);
+    }(std::index_sequence_for<NamedTypes...>{});
+  }
+}
+
+/**
+ * @brief Transpose contiguous rows into a new NamedTupleColumns
+ * @tparam Rows type of a contiguous range of NamedTuple
+ * @param rows rows to transpose
+ * @return a NamedTupleColumns holding the rows
+ */
+template <std::ranges::contiguous_range Rows>
+  requires(std::ranges::sized_range<Rows> && is_named_tuple_v<std::ranges::range_value_t<Rows>>)
+[[nodiscard]] auto to_columns(const Rows& rows) {
+  using NT = std::ranges::range_value_t<Rows>;
+  typename ColumnsOf<NT>::type columns{};
+  to_columns(std::span<const NT>{std::ranges::data(rows), std::ranges::size(rows)}, columns);
+  return columns;
+}
+
+/**
+ * @brief Overwrite contiguous rows with the rows of a NamedTupleColumns
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ * @param columns container holding the rows to copy
+ * @param rows rows to overwrite
+ * @return the number of rows written, the smaller of the sizes of columns and rows
+ */
+template <typename... NamedTypes>
+std::size_t from_columns(const NamedTupleColumns<NamedTypes...>& columns,
+                         std::span<NamedTuple<NamedTypes...>> rows) {
+  using NT = NamedTuple<NamedTypes...>;
+  const std::size_t count{std::min(columns.size(), rows.size())};
+
+  for (std::size_t block{0}; block < count; block += kTransposeBlockRows) {
+    const auto size = std::min(kTransposeBlockRows, count - block);
+    [&rows, &columns, block, size]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+      (
+          [&rows, &columns, block, size]<std::size_t Index>() {
+            using Type = std::tuple_element_t<Index, typename NT::Base>;
+            const auto column = columns.template column<Index>().subspan(block, size);
+            if constexpr (std::is_trivially_copyable_v<Type>) {
+              scatter_strided(column.data(),
+                              reinterpret_cast<std::byte*>(&rows[block].template get<Index>()),
+                              sizeof(NT), size);
+            } else {
+              for (std::size_t index{0}; index < size; ++index) {
+                rows[block + index].template get<Index>() = column[index];
+              }
+            }
+          }.template operator()<Indices>(),
+          ...);
+    }(std::index_sequence_for<NamedTypes...>{});
+  }
+  return count;
+}
+
+/**
+ * @brief Transpose the rows of a NamedTupleColumns into a vector of NamedTuple
+ * @tparam NamedTypes pack of NamedType in the NamedTuple
+ * @param columns container holding the rows to copy
+ * @return a vector holding a NamedTuple for every row
+ */
+template <typename... NamedTypes>
+[[nodiscard]] std::vector<NamedTuple<NamedTypes...>> from_columns(
+    const NamedTupleColumns<NamedTypes...>& columns) {
+  std::vector<NamedTuple<NamedTypes...>> rows(columns.size());
+  from_columns(columns, std::span{rows});
+  return rows;
+}
+
+}  // namespace mguid
+
+#endif  // MGUID_NAMEDTUPLETRANSPOSE_H
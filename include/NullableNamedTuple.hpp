@@ -0,0 +1,403 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+
+#ifndef MGUID_NULLABLENAMEDTUPLE_H
+#define MGUID_NULLABLENAMEDTUPLE_H
+
+#include "NamedTupleSerialization.hpp"
+#include "PackedNamedTuple.hpp"
+
+#include <array>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace mguid {
+
+/**
+ * @brief A NamedTuple whose elements may each be absent, tracked by one validity bitmap
+ *
+ * Unlike a NamedTuple of std::optional, which pays for a flag and its padding in every element,
+ * the presence of every element is a single bit in a bitmap shared by the whole tuple. Values are
+ * stored in a PackedNamedTuple, and an absent element always holds a value initialized value.
+ *
+ * @tparam NamedTypes pack of NamedType types with unique names
+ */
+template <typename... NamedTypes>
+  requires(all_unique_v<NamedTypes...> &&
+           (std::is_default_constructible_v<typename ExtractType<NamedTypes>::type> && ...))
+class NullableNamedTuple {
+public:
+  using Values = PackedNamedTuple<NamedTypes...>;
+  using Word = BitmapWord<sizeof...(NamedTypes)>;
+
+  static constexpr std::size_t kWordBits{sizeof(Word) * 8};
+  static constexpr std::size_t kWordCount{(sizeof...(NamedTypes) + kWordBits - 1) / kWordBits};
+
+  using Bitmap = std::array<Word, kWordCount>;
+
+  /**
+   * @brief Get the bitmap in which every element is present
+   * @return a bitmap with the bit of every element set
+   */
+  [[nodiscard]] static constexpr Bitmap full_bitmap() noexcept {
+    Bitmap bitmap{};
+    for (std::size_t index{0}; index < sizeof...(NamedTypes); ++index) {
+      bitmap[index / kWordBits] |= static_cast<Word>(Word{1} << (index % kWordBits));
+    }
+    return bitmap;
+  }
+
+  /**
+   * @brief Construct this NullableNamedTuple with every element absent
+   */
+  constexpr NullableNamedTuple() = default;
+
+  /**
+   * @brief Construct this NullableNamedTuple with every element present
+   * @param values NamedTuple with the same NamedTypes to copy the elements from
+   */
+  constexpr explicit NullableNamedTuple(const NamedTuple<NamedTypes...>& values)
+      : m_values{values}, m_bitmap{full_bitmap()} {}
+
+  /**
+   * @brief Construct this NullableNamedTuple with every element present
+   * @param values NamedTuple with the same NamedTypes to move the elements from
+   */
+  constexpr explicit NullableNamedTuple(NamedTuple<NamedTypes...>&& values)
+      : m_values{std::move(values)}, m_bitmap{full_bitmap()} {}
+
+  /**
+   * @brief Get the number of elements this NullableNamedTuple holds, present or not
+   * @return the number of elements this NullableNamedTuple holds
+   */
+  [[nodiscard]] constexpr std::size_t size() const { return sizeof...(NamedTypes); }
+
+  /**
+   * @brief Check whether the element whose declared index is Index is present
+   * @tparam Index declared index of the element
+   * @return true if the element is present; otherwise false
+   */
+  template <std::size_t Index>
+    requires(Index < sizeof...(NamedTypes))
+  [[nodiscard]] constexpr bool has() const noexcept {
+    return ((m_bitmap[Index / kWordBits] >> (Index % kWordBits)) & Word{1}) != 0;
+  }
+
+  /**
+   * @brief Check whether the element whose name is Tag is present
+   * @tparam Tag a StringLiteral to search for
+   * @return true if the element is present; otherwise false
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] constexpr bool has() const noexcept {
+    return has<key_index_v<Tag, NamedTypes...>>();
+  }
+
+  /**
+   * @brief Get a pointer to the element whose name is Tag if it is present
+   * @tparam Tag a StringLiteral to search for
+   * @return a pointer to the element if it is present; otherwise nullptr
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] constexpr auto* get_if() noexcept {
+    return has<Tag>() ? &m_values.template get<Tag>() : nullptr;
+  }
+
+  /**
+   * @brief Get a pointer to the element whose name is Tag if it is present
+   * @tparam Tag a StringLiteral to search for
+   * @return a pointer to the element if it is present; otherwise nullptr
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] constexpr const auto* get_if() const noexcept {
+    return has<Tag>() ? &m_values.template get<Tag>() : nullptr;
+  }
+
+  /**
+   * @brief Get a copy of the element whose name is Tag, or a fallback if it is absent
+   * @tparam Tag a StringLiteral to search for
+   * @tparam Value type of the fallback, convertible to the type of the element
+   * @param fallback value to return if the element is absent
+   * @return the element if it is present; otherwise fallback
+   */
+  template <StringLiteral Tag, typename Value>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] constexpr auto value_or(Value&& fallback) const {
+    using Type = std::remove_cvref_t<decltype(m_values.template get<Tag>())>;
+    return has<Tag>() ? m_values.template get<Tag>()
+                      : static_cast<Type>(std::forward<Value>(fallback));
+  }
+
+  /**
+   * @brief Set the element whose name is Tag to value and mark it present
+   * @tparam Tag StringLiteral element name
+   * @tparam Value type of value, convertible to the type of the element associated with Tag
+   * @param value value to set
+   */
+  template <StringLiteral Tag, typename Value>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  constexpr void set(Value&& value) {
+    m_values.template set<Tag>(std::forward<Value>(value));
+    mark<key_index_v<Tag, NamedTypes...>>();
+  }
+
+  /**
+   * @brief Mark the element whose name is Tag absent and value initialize it
+   * @tparam Tag StringLiteral element name
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  constexpr void reset() {
+    constexpr auto kIndex = key_index_v<Tag, NamedTypes...>;
+    m_values.template get<kIndex>() = std::tuple_element_t<kIndex, Values>{};
+    m_bitmap[kIndex / kWordBits] &= static_cast<Word>(~(Word{1} << (kIndex % kWordBits)));
+  }
+
+  /**
+   * @brief Mark every element absent and value initialize it
+   */
+  constexpr void reset() {
+    m_values = Values{};
+    m_bitmap = Bitmap{};
+  }
+
+  /**
+   * @brief Count the present elements with one popcount per bitmap word
+   * @return the number of present elements
+   */
+  [[nodiscard]] constexpr std::size_t count_present() const noexcept {
+    std::size_t count{0};
+    for (const auto word : m_bitmap) { count += static_cast<std::size_t>(std::popcount(word)); }
+    return count;
+  }
+
+  /**
+   * @brief Check whether every element is present
+   * @return true if every element is present; otherwise false
+   */
+  [[nodiscard]] constexpr bool all() const noexcept { return m_bitmap == full_bitmap(); }
+
+  /**
+   * @brief Check whether no element is present
+   * @return true if no element is present; otherwise false
+   */
+  [[nodiscard]] constexpr bool none() const noexcept { return m_bitmap == Bitmap{}; }
+
+  /**
+   * @brief Get the validity bitmap, bit i of the bitmap is set if the element at index i is present
+   * @return a const reference to the words of the bitmap
+   */
+  [[nodiscard]] constexpr const Bitmap& bitmap() const noexcept { return m_bitmap; }
+
+  /**
+   * @brief Get the stored values, absent elements hold value initialized values
+   * @return a const reference to the stored values
+   */
+  [[nodiscard]] constexpr const Values& values() const noexcept { return m_values; }
+
+  /**
+   * @brief Compare the presence of every element and the values of the present elements
+   * @param other another NullableNamedTuple to compare against
+   * @return true if the same elements are present and their values are equal; otherwise false
+   */
+  [[nodiscard]] constexpr bool operator==(const NullableNamedTuple& other) const {
+    if (m_bitmap != other.m_bitmap) { return false; }
+    return std::invoke(
+        [this, &other]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+          return ((!has<Indices>() || m_values.template get<Indices>() ==
+                                          other.m_values.template get<Indices>()) &&
+                  ...);
+        },
+        std::index_sequence_for<NamedTypes...>{});
+  }
+
+  /**
+   * @brief Compare element by element in declared order, ordering an absent element before a
+   * present one like std::optional
+   * @param other another NullableNamedTuple to compare against
+   * @return The relation between the first pair of non-equivalent elements if there is any,
+   * std::strong_ordering::equal otherwise.
+   */
+  [[nodiscard]] constexpr auto operator<=>(const NullableNamedTuple& other) const {
+    std::common_comparison_category_t<
+        std::strong_ordering,
+        SynthThreeWayResultT<typename ExtractType<NamedTypes>::type,
+                             typename ExtractType<NamedTypes>::type>...>
+        result = std::strong_ordering::equivalent;
+
+    [this, &other, &result]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+      ([this, &other, &result]<std::size_t Index>() {
+        const bool present{has<Index>()};
+        if (present != other.template has<Index>()) {
+          result = present <=> other.template has<Index>();
+        } else if (present) {
+          result = SynthThreeWay(m_values.template get<Index>(),
+                                 other.m_values.template get<Index>());
+        }
+        return result != 0;
+      }.template operator()<Indices>() ||
+       ...);
+    }(std::index_sequence_for<NamedTypes...>{});
+
+    return result;
+  }
+
+private:
+  template <std::size_t Index>
+  constexpr void mark() noexcept {
+    m_bitmap[Index / kWordBits] |= static_cast<Word>(Word{1} << (Index % kWordBits));
+  }
+
+  Values m_values{};
+  Bitmap m_bitmap{};
+};
+
+/**
+ * @brief Count the rows of a range of NullableNamedTuple in which the element Tag is present
+ * @tparam Tag a StringLiteral to search for
+ * @tparam Rows type of a range of NullableNamedTuple
+ * @param rows rows to scan
+ * @return the number of rows in which the element Tag is present
+ */
+template <StringLiteral Tag, std::ranges::input_range Rows>
+[[nodiscard]] std::size_t count_present(const Rows& rows) {
+  std::size_t count{0};
+  for (const auto& row : rows) { count += row.template has<Tag>() ? 1 : 0; }
+  return count;
+}
+
+/**
+ * @brief The binary layout of a NullableNamedTuple whose elements are all trivially copyable
+ *
+ * A serialized record is a 64-bit fingerprint, the validity bitmap and then every element in
+ * declared order with no padding. Absent elements are written as their value initialized value.
+ *
+ * @tparam NamedTypes pack of NamedType in the NullableNamedTuple
+ */
+template <typename... NamedTypes>
+  requires(TriviallySerializable<typename ExtractType<NamedTypes>::type> && ...)
+struct BinaryLayout<NullableNamedTuple<NamedTypes...>> {
+  using Bitmap = typename NullableNamedTuple<NamedTypes...>::Bitmap;
+
+  static constexpr std::size_t header_size{sizeof(std::uint64_t) + sizeof(Bitmap)};
+
+  static constexpr std::size_t size{
+      header_size + (std::size_t{0} + ... + sizeof(typename ExtractType<NamedTypes>::type))};
+
+  static constexpr std::array<std::size_t, sizeof...(NamedTypes)> offsets = [] {
+    std::array<std::size_t, sizeof...(NamedTypes)> result{};
+    std::size_t index{0};
+    std::size_t offset{header_size};
+    ((result[index++] = offset, offset += sizeof(typename ExtractType<NamedTypes>::type)), ...);
+    return result;
+  }();
+
+  // distinct from the fingerprint of NamedTuple<NamedTypes...>, whose records have no bitmap
+  static constexpr std::uint64_t fingerprint{
+      mix64(BinaryLayout<NamedTuple<NamedTypes...>>::fingerprint ^ 0x4E554C4CULL)};
+};
+
+/**
+ * @brief Serialize a NullableNamedTuple into a buffer
+ * @tparam NamedTypes pack of NamedType in the NullableNamedTuple
+ * @param nt NullableNamedTuple to serialize
+ * @param buffer buffer to write into, at least serialized_size_v bytes long
+ * @return the number of bytes written, or 0 if the buffer is too small
+ */
+template <typename... NamedTypes>
+  requires(TriviallySerializable<typename ExtractType<NamedTypes>::type> && ...)
+std::size_t serialize(const NullableNamedTuple<NamedTypes...>& nt,
+                      std::span<std::byte> buffer) noexcept {
+  using Layout = BinaryLayout<NullableNamedTuple<NamedTypes...>>;
+  if (buffer.size() < Layout::size) { return 0; }
+
+  std::memcpy(buffer.data(), &Layout::fingerprint, sizeof(Layout::fingerprint));
+  std::memcpy(buffer.data() + sizeof(Layout::fingerprint), nt.bitmap().data(),
+              sizeof(typename Layout::Bitmap));
+  [&nt, &buffer]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+    (std::memcpy(buffer.data() + Layout::offsets[Indices], &nt.values().template get<Indices>(),
+                 sizeof(std::tuple_element_t<Indices, PackedNamedTuple<NamedTypes...>>)),
+     ...);
+  }(std::index_sequence_for<NamedTypes...>{});
+  return Layout::size;
+}
+
+/**
+ * @brief Deserialize a buffer into an existing NullableNamedTuple
+ * @tparam NamedTypes pack of NamedType in the NullableNamedTuple
+ * @param buffer buffer holding a record serialized by serialize
+ * @param nt NullableNamedTuple to overwrite
+ * @return true if the buffer held a record with a matching fingerprint; otherwise false and nt is
+ * left unchanged
+ */
+template <typename... NamedTypes>
+  requires(TriviallySerializable<typename ExtractType<NamedTypes>::type> && ...)
+bool deserialize(std::span<const std::byte> buffer,
+                 NullableNamedTuple<NamedTypes...>& nt) noexcept {
+  using NT = NullableNamedTuple<NamedTypes...>;
+  using Layout = BinaryLayout<NT>;
+  if (buffer.size() < Layout::size || read_fingerprint(buffer) != Layout::fingerprint) {
+    return false;
+  }
+
+  typename Layout::Bitmap bitmap{};
+  std::memcpy(bitmap.data(), buffer.data() + sizeof(Layout::fingerprint), sizeof(bitmap));
+
+  nt.reset();
+  [&nt, &buffer, &bitmap]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+    ([&nt, &buffer, &bitmap]<std::size_t Index>() {
+      constexpr auto kBits = NT::kWordBits;
+      if (((bitmap[Index / kBits] >> (Index % kBits)) & 1U) == 0) { return; }
+      std::tuple_element_t<Index, PackedNamedTuple<NamedTypes...>> value;
+      std::memcpy(&value, buffer.data() + Layout::offsets[Index], sizeof(value));
+      nt.template set<std::tuple_element_t<Index, std::tuple<NamedTypes...>>{}.tag()>(value);
+    }.template operator()<Indices>(),
+     ...);
+  }(std::index_sequence_for<NamedTypes...>{});
+  return true;
+}
+
+}  // namespace mguid
+
+#endif  // MGUID_NULLABLENAMEDTUPLE_H
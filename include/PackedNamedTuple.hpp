@@ -0,0 +1,428 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+#ifndef MGUID_PACKEDNAMEDTUPLE_H
+#define MGUID_PACKEDNAMEDTUPLE_H
+
+#include "NamedTuple.hpp"
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace mguid {
+
+/**
+ * @brief Compute the order in which elements are placed in storage to minimize padding
+ *
+ * Elements are ordered by decreasing alignment. Elements with equal alignment keep their declared
+ * order.
+ *
+ * @tparam Types element types in declared order
+ * @return an array mapping each storage slot to the declared index of the element it holds
+ */
+template <typename... Types>
+constexpr std::array<std::size_t, sizeof...(Types)> packed_storage_order() {
+  constexpr std::array<std::size_t, sizeof...(Types)> alignments{alignof(Types)...};
+  std::array<std::size_t, sizeof...(Types)> order{};
+  for (std::size_t i{0}; i < order.size(); ++i) {
+    order[i] = i;
+    for (std::size_t j{i}; j > 0 && alignments[order[j - 1]] < alignments[order[j]]; --j) {
+      std::swap(order[j - 1], order[j]);
+    }
+  }
+  return order;
+}
+
+/**
+ * @brief A NamedTuple whose elements are stored sorted by alignment to minimize padding
+ *
+ * The storage order is an implementation detail; every accessor, std::tuple_size,
+ * std::tuple_element and structured bindings behave as if the declared order were used.
+ *
+ * @tparam NamedTypes pack of NamedType types with unique names
+ */
+template <typename... NamedTypes>
+  requires(all_unique_v<NamedTypes...>)
+class PackedNamedTuple {
+  using Declared = std::tuple<typename ExtractType<NamedTypes>::type...>;
+
+  static constexpr std::array<std::size_t, sizeof...(NamedTypes)> kStorageOrder{
+      packed_storage_order<typename ExtractType<NamedTypes>::type...>()};
+
+  static constexpr std::array<std::size_t, sizeof...(NamedTypes)> kStorageSlot = [] {
+    std::array<std::size_t, sizeof...(NamedTypes)> slots{};
+    for (std::size_t i{0}; i < slots.size(); ++i) { slots[kStorageOrder[i]] = i; }
+    return slots;
+  }();
+
+  template <std::size_t... Slots>
+  static auto storage_type(std::index_sequence<Slots...>)
+      -> std::tuple<std::tuple_element_t<kStorageOrder[Slots], Declared>...>;
+
+public:
+  using Unpacked = NamedTuple<NamedTypes...>;
+  using Storage = decltype(storage_type(std::index_sequence_for<NamedTypes...>{}));
+
+  /**
+   * @brief Construct this PackedNamedTuple value initializing all elements
+   */
+  constexpr PackedNamedTuple() = default;
+
+  /**
+   * @brief Construct this PackedNamedTuple initializing all elements
+   * @tparam InitTypes types of initializer values
+   * @param init_values values to initialize each tuple element, in declared order
+   */
+  template <typename... InitTypes>
+    requires(sizeof...(InitTypes) == sizeof...(NamedTypes) && sizeof...(InitTypes) > 0 &&
+             !(sizeof...(InitTypes) == 1 &&
+               (std::is_same_v<std::remove_cvref_t<InitTypes>, PackedNamedTuple> || ...)))
+  constexpr explicit PackedNamedTuple(InitTypes&&... init_values)
+      : PackedNamedTuple(std::index_sequence_for<NamedTypes...>{},
+                         std::forward_as_tuple(std::forward<InitTypes>(init_values)...)) {}
+
+  /**
+   * @brief Construct this PackedNamedTuple by copying the elements of a NamedTuple
+   * @param other NamedTuple with the same NamedTypes to copy from
+   */
+  constexpr explicit PackedNamedTuple(const Unpacked& other)
+      : PackedNamedTuple(std::index_sequence_for<NamedTypes...>{},
+                         static_cast<const typename Unpacked::Base&>(other)) {}
+
+  /**
+   * @brief Construct this PackedNamedTuple by moving the elements of a NamedTuple
+   * @param other NamedTuple with the same NamedTypes to move from
+   */
+  constexpr explicit PackedNamedTuple(Unpacked&& other)
+      : PackedNamedTuple(std::index_sequence_for<NamedTypes...>{},
+                         static_cast<typename Unpacked::Base&&>(other)) {}
+
+  /**
+   * @brief Get the number of elements this PackedNamedTuple holds
+   * @return the number of elements this PackedNamedTuple holds
+   */
+  [[nodiscard]] constexpr std::size_t size() const { return sizeof...(NamedTypes); }
+
+  /**
+   * @brief Get the storage slot of the element declared at index
+   * @param index declared index of the element
+   * @return the index of the element within Storage
+   */
+  [[nodiscard]] static constexpr std::size_t storage_index(std::size_t index) {
+    return kStorageSlot[index];
+  }
+
+  /**
+   * @brief Copy the elements of this PackedNamedTuple into a NamedTuple in declared order
+   * @return a NamedTuple with the same NamedTypes
+   */
+  [[nodiscard]] constexpr Unpacked to_tuple() const& {
+    return std::invoke(
+        [this]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+          return Unpacked{get<Indices>()...};
+        },
+        std::index_sequence_for<NamedTypes...>{});
+  }
+
+  /**
+   * @brief Move the elements of this PackedNamedTuple into a NamedTuple in declared order
+   * @return a NamedTuple with the same NamedTypes
+   */
+  [[nodiscard]] constexpr Unpacked to_tuple() && {
+    return std::invoke(
+        [this]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+          return Unpacked{std::move(*this).template get<Indices>()...};
+        },
+        std::index_sequence_for<NamedTypes...>{});
+  }
+
+  /**
+   * @brief Set the element of the PackedNamedTuple with the name Tag to value
+   * @tparam Tag StringLiteral element name
+   * @tparam Value type of value, convertible to the type of the element associated with Tag
+   * @param value value to set
+   */
+  template <StringLiteral Tag, typename Value>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...> &&
+             std::is_convertible_v<
+                 Value, std::tuple_element_t<key_index_v<Tag, NamedTypes...>, Declared>>)
+  constexpr void set(Value&& value) {
+    get<Tag>() = std::forward<Value>(value);
+  }
+
+  /**
+   * @brief Extracts the element of the PackedNamedTuple whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @return the element of the PackedNamedTuple whose name is Tag
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] constexpr auto& get() & noexcept {
+    return get<key_index_v<Tag, NamedTypes...>>();
+  }
+
+  /**
+   * @brief Extracts the element of the PackedNamedTuple whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @return the element of the PackedNamedTuple whose name is Tag
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] constexpr const auto& get() const& noexcept {
+    return get<key_index_v<Tag, NamedTypes...>>();
+  }
+
+  /**
+   * @brief Extracts the element of the PackedNamedTuple whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @return the element of the PackedNamedTuple whose name is Tag
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] constexpr auto&& get() && noexcept {
+    return std::move(*this).template get<key_index_v<Tag, NamedTypes...>>();
+  }
+
+  /**
+   * @brief Extracts the element of the PackedNamedTuple whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @return the element of the PackedNamedTuple whose name is Tag
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] constexpr const auto&& get() const&& noexcept {
+    return std::move(*this).template get<key_index_v<Tag, NamedTypes...>>();
+  }
+
+  /**
+   * @brief Extracts the element of the PackedNamedTuple whose declared index is Index
+   * @tparam Index declared index of the element to get
+   * @return the element of the PackedNamedTuple whose declared index is Index
+   */
+  template <std::size_t Index>
+    requires(sizeof...(NamedTypes) > 0 && Index < sizeof...(NamedTypes))
+  [[nodiscard]] constexpr auto& get() & noexcept {
+    return std::get<kStorageSlot[Index]>(m_storage);
+  }
+
+  /**
+   * @brief Extracts the element of the PackedNamedTuple whose declared index is Index
+   * @tparam Index declared index of the element to get
+   * @return the element of the PackedNamedTuple whose declared index is Index
+   */
+  template <std::size_t Index>
+    requires(sizeof...(NamedTypes) > 0 && Index < sizeof...(NamedTypes))
+  [[nodiscard]] constexpr const auto& get() const& noexcept {
+    return std::get<kStorageSlot[Index]>(m_storage);
+  }
+
+  /**
+   * @brief Extracts the element of the PackedNamedTuple whose declared index is Index
+   * @tparam Index declared index of the element to get
+   * @return the element of the PackedNamedTuple whose declared index is Index
+   */
+  template <std::size_t Index>
+    requires(sizeof...(NamedTypes) > 0 && Index < sizeof...(NamedTypes))
+  [[nodiscard]] constexpr auto&& get() && noexcept {
+    return std::get<kStorageSlot[Index]>(std::move(m_storage));
+  }
+
+  /**
+   * @brief Extracts the element of the PackedNamedTuple whose declared index is Index
+   * @tparam Index declared index of the element to get
+   * @return the element of the PackedNamedTuple whose declared index is Index
+   */
+  template <std::size_t Index>
+    requires(sizeof...(NamedTypes) > 0 && Index < sizeof...(NamedTypes))
+  [[nodiscard]] constexpr const auto&& get() const&& noexcept {
+    return std::get<kStorageSlot[Index]>(std::move(m_storage));
+  }
+
+  /**
+   * @brief Element-wise comparison by tag against another PackedNamedTuple
+   *
+   * Like NamedTuple, the order of the elements does not matter, only that all keys of this exist in
+   * the other.
+   *
+   * @tparam OtherNamedTypes pack of types in other PackedNamedTuple
+   * @param other another PackedNamedTuple to compare against
+   * @return Returns true if all pairs of corresponding elements are equal; otherwise false
+   */
+  template <typename... OtherNamedTypes>
+  [[nodiscard]] constexpr bool operator==(const PackedNamedTuple<OtherNamedTypes...>& other) const {
+    static_assert(sizeof...(NamedTypes) == sizeof...(OtherNamedTypes));
+    return ((get<NamedTypes{}.tag()>() == other.template get<NamedTypes{}.tag()>()) && ...);
+  }
+
+  /**
+   * @brief Element-wise comparison by tag against a NamedTuple
+   * @tparam OtherNamedTypes pack of types in the NamedTuple
+   * @param other a NamedTuple to compare against
+   * @return Returns true if all pairs of corresponding elements are equal; otherwise false
+   */
+  template <typename... OtherNamedTypes>
+  [[nodiscard]] constexpr bool operator==(const NamedTuple<OtherNamedTypes...>& other) const {
+    static_assert(sizeof...(NamedTypes) == sizeof...(OtherNamedTypes));
+    return ((get<NamedTypes{}.tag()>() == other.template get<NamedTypes{}.tag()>()) && ...);
+  }
+
+  /**
+   * @brief Spaceship compare by tag against another PackedNamedTuple, in the declared order of this
+   * @tparam OtherNamedTypes pack of types in other PackedNamedTuple
+   * @param other another PackedNamedTuple to compare against
+   * @return The relation between the first pair of non-equivalent elements if there is any,
+   * std::strong_ordering::equal otherwise.
+   */
+  template <typename... OtherNamedTypes>
+  [[nodiscard]] constexpr auto operator<=>(
+      const PackedNamedTuple<OtherNamedTypes...>& other) const {
+    return three_way(other);
+  }
+
+  /**
+   * @brief Spaceship compare by tag against a NamedTuple, in the declared order of this
+   * @tparam OtherNamedTypes pack of types in the NamedTuple
+   * @param other a NamedTuple to compare against
+   * @return The relation between the first pair of non-equivalent elements if there is any,
+   * std::strong_ordering::equal otherwise.
+   */
+  template <typename... OtherNamedTypes>
+  [[nodiscard]] constexpr auto operator<=>(const NamedTuple<OtherNamedTypes...>& other) const {
+    return three_way(other);
+  }
+
+private:
+  template <std::size_t... Slots, typename Source>
+  constexpr PackedNamedTuple(std::index_sequence<Slots...>, Source&& source)
+      : m_storage{std::get<kStorageOrder[Slots]>(std::forward<Source>(source))...} {}
+
+  template <typename Other>
+  constexpr auto three_way(const Other& other) const {
+    static_assert(sizeof...(NamedTypes) == std::tuple_size_v<Other>);
+    std::common_comparison_category_t<SynthThreeWayResultT<
+        typename ExtractType<NamedTypes>::type,
+        std::remove_cvref_t<decltype(other.template get<NamedTypes{}.tag()>())>>...>
+        result = std::strong_ordering::equivalent;
+
+    ([this, &other, &result]<StringLiteral Tag>() {
+      result = SynthThreeWay(this->get<Tag>(), other.template get<Tag>());
+      return result != 0;
+    }.template operator()<NamedTypes{}.tag()>() ||
+     ...);
+
+    return result;
+  }
+
+  Storage m_storage{};
+};
+
+/**
+ * @brief Extracts the element from the PackedNamedTuple with the key Tag
+ * @tparam Tag the tag for the element to find
+ * @tparam NamedTypes pack of NamedType in the PackedNamedTuple
+ * @param nt PackedNamedTuple whose element to extract
+ * @return A reference to the selected element of nt
+ */
+template <StringLiteral Tag, typename... NamedTypes>
+  requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+[[nodiscard]] constexpr auto& get(PackedNamedTuple<NamedTypes...>& nt) noexcept {
+  return nt.template get<Tag>();
+}
+
+/**
+ * @brief Extracts the element from the PackedNamedTuple with the key Tag
+ * @tparam Tag the tag for the element to find
+ * @tparam NamedTypes pack of NamedType in the PackedNamedTuple
+ * @param nt PackedNamedTuple whose element to extract
+ * @return A reference to the selected element of nt
+ */
+template <StringLiteral Tag, typename... NamedTypes>
+  requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+[[nodiscard]] constexpr auto&& get(PackedNamedTuple<NamedTypes...>&& nt) noexcept {
+  return std::move(nt).template get<Tag>();
+}
+
+/**
+ * @brief Extracts the element from the PackedNamedTuple with the key Tag
+ * @tparam Tag the tag for the element to find
+ * @tparam NamedTypes pack of NamedType in the PackedNamedTuple
+ * @param nt PackedNamedTuple whose element to extract
+ * @return A reference to the selected element of nt
+ */
+template <StringLiteral Tag, typename... NamedTypes>
+  requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+[[nodiscard]] constexpr const auto& get(const PackedNamedTuple<NamedTypes...>& nt) noexcept {
+  return nt.template get<Tag>();
+}
+
+/**
+ * @brief Extracts the element from the PackedNamedTuple with the key Tag
+ * @tparam Tag the tag for the element to find
+ * @tparam NamedTypes pack of NamedType in the PackedNamedTuple
+ * @param nt PackedNamedTuple whose element to extract
+ * @return A reference to the selected element of nt
+ */
+template <StringLiteral Tag, typename... NamedTypes>
+  requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+[[nodiscard]] constexpr const auto&& get(const PackedNamedTuple<NamedTypes...>&& nt) noexcept {
+  return std::move(nt).template get<Tag>();
+}
+}  // namespace mguid
+
+// NOLINTBEGIN(cert-dcl58-cpp)
+namespace std {
+/**
+ * @brief Specialization of std::tuple_size for PackedNamedTuple
+ * @tparam NamedTypes type list for a PackedNamedTuple
+ */
+template <typename... NamedTypes>
+struct tuple_size<mguid::PackedNamedTuple<NamedTypes...>>
+    : std::integral_constant<std::size_t, sizeof...(NamedTypes)> {};
+
+/**
+ * @brief Specialization of std::tuple_element for PackedNamedTuple, in declared order
+ * @tparam Index index of tuple element in tuple
+ * @tparam NamedTypes type list for a PackedNamedTuple
+ */
+template <std::size_t Index, typename... NamedTypes>
+struct tuple_element<Index, mguid::PackedNamedTuple<NamedTypes...>> {
+  static_assert(Index < sizeof...(NamedTypes), "Index out of range");
+  using type =
+      std::tuple_element_t<Index, std::tuple<typename mguid::ExtractType<NamedTypes>::type...>>;
+};
+}  // namespace std
+// NOLINTEND(cert-dcl58-cpp)
+
+#endif  // MGUID_PACKEDNAMEDTUPLE_H
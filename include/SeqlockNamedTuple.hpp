@@ -0,0 +1,226 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+
+#ifndef MGUID_SEQLOCKNAMEDTUPLE_H
+#define MGUID_SEQLOCKNAMEDTUPLE_H
+
+#include "NamedTuple.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace mguid {
+
+/**
+ * @brief A NamedTuple published by a single writer to any number of readers through a sequence
+ * lock, readers copy a consistent record without taking a lock and retry if a write overlapped
+ *
+ * The elements are kept packed in declared order in an array of atomic words, so readers racing
+ * with the writer never perform a data race, and the sequence number tells them whether the words
+ * they copied belong to a single publication.
+ *
+ * Only one thread may call store and publish at a time.
+ *
+ * @tparam NamedTypes pack of NamedType with unique names and trivially copyable types
+ */
+template <typename... NamedTypes>
+  requires(all_unique_v<NamedTypes...> &&
+           (std::is_trivially_copyable_v<typename ExtractType<NamedTypes>::type> && ...))
+class SeqlockNamedTuple {
+  static constexpr std::array<std::size_t, sizeof...(NamedTypes)> kOffsets = [] {
+    std::array<std::size_t, sizeof...(NamedTypes)> result{};
+    std::size_t index{0};
+    std::size_t offset{0};
+    ((result[index++] = offset, offset += sizeof(typename ExtractType<NamedTypes>::type)), ...);
+    return result;
+  }();
+
+  static constexpr std::size_t kWords{
+      ((std::size_t{0} + ... + sizeof(typename ExtractType<NamedTypes>::type)) +
+       sizeof(std::uint64_t) - 1) /
+      sizeof(std::uint64_t)};
+
+  using Words = std::array<std::uint64_t, kWords>;
+
+public:
+  using Snapshot = NamedTuple<NamedTypes...>;
+
+  /**
+   * @brief Construct this SeqlockNamedTuple publishing a value initialized record
+   */
+  SeqlockNamedTuple() noexcept { store(Snapshot{}); }
+
+  /**
+   * @brief Construct this SeqlockNamedTuple publishing an initial record
+   * @param initial record to publish
+   */
+  explicit SeqlockNamedTuple(const Snapshot& initial) noexcept { store(initial); }
+
+  SeqlockNamedTuple(const SeqlockNamedTuple&) = delete;
+  SeqlockNamedTuple& operator=(const SeqlockNamedTuple&) = delete;
+
+  /**
+   * @brief Get the number of records published so far, including the initial record
+   * @return the number of completed publications
+   */
+  [[nodiscard]] std::uint64_t version() const noexcept {
+    return m_sequence.load(std::memory_order_acquire) / 2;
+  }
+
+  /**
+   * @brief Try to copy the latest record once, without retrying
+   * @param out NamedTuple to copy the record into
+   * @return true if no write overlapped the copy and out holds a consistent record; otherwise
+   * false and out holds an unspecified mix of records
+   */
+  bool try_load(Snapshot& out) const noexcept {
+    const std::uint64_t before{m_sequence.load(std::memory_order_acquire)};
+    if ((before & 1U) != 0) { return false; }
+    Words words{};
+    for (std::size_t index{0}; index < kWords; ++index) {
+      words[index] = m_words[index].load(std::memory_order_relaxed);
+    }
+    // keeps the loads of the words before the second load of the sequence number
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (m_sequence.load(std::memory_order_relaxed) != before) { return false; }
+    unpack(words, out);
+    return true;
+  }
+
+  /**
+   * @brief Copy the latest record, retrying while writes overlap the copy
+   * @return a consistent copy of the latest record
+   */
+  [[nodiscard]] Snapshot load() const noexcept {
+    Snapshot result{};
+    while (!try_load(result)) {}
+    return result;
+  }
+
+  /**
+   * @brief Copy a single element of the latest record
+   * @tparam Tag a StringLiteral to search for
+   * @return the element whose name is Tag in the latest record
+   */
+  template <StringLiteral Tag>
+    requires(sizeof...(NamedTypes) > 0 && is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] auto load() const noexcept {
+    return load().template get<Tag>();
+  }
+
+  /**
+   * @brief Publish a new record
+   * @param value record to publish
+   */
+  void store(const Snapshot& value) noexcept {
+    m_staging = value;
+    write(m_staging);
+  }
+
+  /**
+   * @brief Update several elements of the last published record and publish the result at once,
+   * readers see either the previous record or the updated one
+   * @tparam Writer type of writer, invocable with a reference to a NamedTuple
+   *
+   * If writer throws nothing is published and its partial edits are discarded, so the copy it
+   * is given is again the last published record.
+   *
+   * @param writer callback updating a copy of the last published record that is owned by the writer
+   */
+  template <typename Writer>
+    requires(std::is_invocable_v<Writer&, Snapshot&>)
+  void publish(Writer&& writer) {
+    try {
+      std::invoke(writer, m_staging);
+    } catch (...) {
+      restore_staging();
+      throw;
+    }
+    write(m_staging);
+  }
+
+private:
+  static void pack(const Snapshot& value, Words& words) noexcept {
+    auto* bytes = reinterpret_cast<unsigned char*>(words.data());
+    [&value, bytes]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+      (std::memcpy(bytes + kOffsets[Indices], &value.template get<Indices>(),
+                   sizeof(std::tuple_element_t<Indices, Snapshot>)),
+       ...);
+    }(std::index_sequence_for<NamedTypes...>{});
+  }
+
+  static void unpack(const Words& words, Snapshot& value) noexcept {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(words.data());
+    [&value, bytes]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+      (std::memcpy(&value.template get<Indices>(), bytes + kOffsets[Indices],
+                   sizeof(std::tuple_element_t<Indices, Snapshot>)),
+       ...);
+    }(std::index_sequence_for<NamedTypes...>{});
+  }
+
+  // only the writer stores the words, so it reads them back without checking the sequence number
+  void restore_staging() noexcept {
+    Words words{};
+    for (std::size_t index{0}; index < kWords; ++index) {
+      words[index] = m_words[index].load(std::memory_order_relaxed);
+    }
+    unpack(words, m_staging);
+  }
+
+  void write(const Snapshot& value) noexcept {
+    Words words{};
+    pack(value, words);
+    const std::uint64_t sequence{m_sequence.load(std::memory_order_relaxed)};
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    // keeps the stores of the words after the odd sequence number
+    std::atomic_thread_fence(std::memory_order_release);
+    for (std::size_t index{0}; index < kWords; ++index) {
+      m_words[index].store(words[index], std::memory_order_relaxed);
+    }
+    m_sequence.store(sequence + 2, std::memory_order_release);
+  }
+
+  alignas(kCacheLineSize) std::atomic<std::uint64_t> m_sequence{0};
+  std::array<std::atomic<std::uint64_t>, kWords> m_words{};
+  // only touched by the writer, kept off the cache lines the readers poll
+  alignas(kCacheLineSize) Snapshot m_staging{};
+};
+
+}  // namespace mguid
+
+#endif  // MGUID_SEQLOCKNAMEDTUPLE_H
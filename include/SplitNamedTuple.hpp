@@ -0,0 +1,465 @@
+/**
+ * @author Matthew Guidry (github: mguid65)
+ * @date 2026-10-14
+ *
+ * @cond IGNORE_LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Matthew Guidry
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @endcond
+ */
+
+
+#ifndef MGUID_SPLITNAMEDTUPLE_H
+#define MGUID_SPLITNAMEDTUPLE_H
+
+#include "NamedTuple.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace mguid {
+
+/**
+ * @brief A list of the tags of the elements a SplitNamedTuple keeps inline
+ * @tparam Tags tags of the hot elements
+ */
+template <StringLiteral... Tags>
+struct HotTags {};
+
+/**
+ * @brief Base template of helper template to partition NamedTypes into hot and cold elements
+ * @tparam Hot unconstrained type
+ * @tparam NamedTypes pack of NamedType
+ */
+template <typename Hot, typename... NamedTypes>
+struct SplitNamedTypes;
+
+/**
+ * @brief Partially specialized helper template, the hot and cold NamedTuples keep the declared
+ * order of their elements
+ * @tparam Tags tags of the hot elements
+ * @tparam NamedTypes pack of NamedType
+ */
+template <StringLiteral... Tags, typename... NamedTypes>
+struct SplitNamedTypes<HotTags<Tags...>, NamedTypes...> {
+  static constexpr std::array<bool, sizeof...(NamedTypes)> kHot{
+      is_one_of_v<NamedTypes{}.tag(), NamedType<Tags, void>...>...};
+
+  using Hot = typename NamedTupleFrom<decltype(std::tuple_cat(
+      std::declval<std::conditional_t<is_one_of_v<NamedTypes{}.tag(), NamedType<Tags, void>...>,
+                                      std::tuple<NamedTypes>, std::tuple<>>>()...))>::type;
+  using Cold = typename NamedTupleFrom<decltype(std::tuple_cat(
+      std::declval<std::conditional_t<is_one_of_v<NamedTypes{}.tag(), NamedType<Tags, void>...>,
+                                      std::tuple<>, std::tuple<NamedTypes>>>()...))>::type;
+
+  // the index of every element within the hot or the cold NamedTuple
+  static constexpr std::array<std::size_t, sizeof...(NamedTypes)> kPositions{[] {
+    std::array<std::size_t, sizeof...(NamedTypes)> result{};
+    std::size_t hot{0};
+    std::size_t cold{0};
+    for (std::size_t index{0}; index < result.size(); ++index) {
+      result[index] = kHot[index] ? hot++ : cold++;
+    }
+    return result;
+  }()};
+
+  // the indices of the hot or the cold elements in declared order
+  template <bool IsHot>
+  static constexpr auto kSources{[] {
+    std::array<std::size_t, std::tuple_size_v<std::conditional_t<IsHot, Hot, Cold>>> result{};
+    std::size_t count{0};
+    for (std::size_t index{0}; index < kHot.size(); ++index) {
+      if (kHot[index] == IsHot) { result[count++] = index; }
+    }
+    return result;
+  }()};
+};
+
+/**
+ * @brief A NamedTuple whose hot elements are stored inline and whose cold elements are stored in a
+ * separately allocated block, so a container of wide records only brings the hot elements into
+ * cache when a loop touches nothing else
+ *
+ * The cold block is allocated from the polymorphic allocator on the first non-const access of a
+ * cold element, including set and structured bindings, and when the tuple is constructed from
+ * values. Until then every cold element reads as value initialized. The hot elements can be chosen
+ * from the counts reported by access_counts when NAMED_TUPLE_ACCESS_COUNTERS is defined.
+ *
+ * @tparam Hot HotTags of the elements to store inline
+ * @tparam NamedTypes pack of NamedType types with unique names
+ */
+template <typename Hot, typename... NamedTypes>
+class SplitNamedTuple;
+
+template <StringLiteral... HotTagValues, typename... NamedTypes>
+  requires(sizeof...(HotTagValues) > 0 && all_unique_v<NamedTypes...> &&
+           (is_one_of_v<HotTagValues, NamedTypes...> && ...))
+class SplitNamedTuple<HotTags<HotTagValues...>, NamedTypes...> {
+  using Split = SplitNamedTypes<HotTags<HotTagValues...>, NamedTypes...>;
+
+public:
+  using allocator_type = std::pmr::polymorphic_allocator<>;
+  using Full = NamedTuple<NamedTypes...>;
+  using HotTuple = typename Split::Hot;
+  using ColdTuple = typename Split::Cold;
+
+  /**
+   * @brief Construct this SplitNamedTuple value initializing all elements, without a cold block
+   */
+  SplitNamedTuple() : SplitNamedTuple(allocator_type{}) {}
+
+  /**
+   * @brief Construct this SplitNamedTuple value initializing all elements, without a cold block
+   * @param alloc allocator of the cold block, also passed to the hot elements that use one
+   */
+  explicit SplitNamedTuple(const allocator_type& alloc)
+      : m_hot{std::allocator_arg, alloc}, m_allocator{alloc} {}
+
+  /**
+   * @brief Construct this SplitNamedTuple from the values of every element in declared order, or
+   * from values associated with names by NamedTypeV
+   * @tparam InitTypes types of initializer values
+   * @param init_values values to initialize the elements with
+   */
+  template <typename... InitTypes>
+    requires(sizeof...(InitTypes) > 0 &&
+             (sizeof...(InitTypes) == sizeof...(NamedTypes) ||
+              (is_value_helper_v<std::remove_cvref_t<InitTypes>> && ...)) &&
+             !(sizeof...(InitTypes) == 1 &&
+               ((std::is_same_v<std::remove_cvref_t<InitTypes>, SplitNamedTuple> ||
+                 std::is_same_v<std::remove_cvref_t<InitTypes>, Full> ||
+                 std::is_same_v<std::remove_cvref_t<InitTypes>, allocator_type>) &&
+                ...)))
+  explicit SplitNamedTuple(InitTypes&&... init_values)
+      : SplitNamedTuple(Full{std::forward<InitTypes>(init_values)...}) {}
+
+  /**
+   * @brief Construct this SplitNamedTuple from a NamedTuple with the same elements
+   * @param full NamedTuple whose elements are copied
+   * @param alloc allocator of the cold block, also passed to the hot elements that use one
+   */
+  explicit SplitNamedTuple(const Full& full, const allocator_type& alloc = {})
+      : m_hot{part<true, HotTuple>(full, alloc)}, m_allocator{alloc} {
+    m_cold = m_allocator.new_object<ColdTuple>(part<false, ColdTuple>(full, alloc));
+  }
+
+  /**
+   * @brief Construct this SplitNamedTuple from a NamedTuple with the same elements
+   * @param full NamedTuple whose elements are moved
+   * @param alloc allocator of the cold block, also passed to the hot elements that use one
+   */
+  explicit SplitNamedTuple(Full&& full, const allocator_type& alloc = {})
+      : m_hot{part<true, HotTuple>(std::move(full), alloc)}, m_allocator{alloc} {
+    m_cold = m_allocator.new_object<ColdTuple>(part<false, ColdTuple>(std::move(full), alloc));
+  }
+
+  /**
+   * @brief Copy construct this SplitNamedTuple, the copy uses the default memory resource like
+   * the copies of std::pmr containers
+   * @param other SplitNamedTuple to copy
+   */
+  SplitNamedTuple(const SplitNamedTuple& other)
+      : m_hot{other.m_hot},
+        m_allocator{std::allocator_traits<allocator_type>::select_on_container_copy_construction(
+            other.m_allocator)} {
+    if (other.m_cold != nullptr) { m_cold = m_allocator.new_object<ColdTuple>(*other.m_cold); }
+  }
+
+  /**
+   * @brief Move construct this SplitNamedTuple, taking over the cold block of other
+   * @param other SplitNamedTuple to move from, left without a cold block
+   */
+  SplitNamedTuple(SplitNamedTuple&& other) noexcept(
+      std::is_nothrow_move_constructible_v<HotTuple>)
+      : m_hot{std::move(other.m_hot)},
+        m_cold{std::exchange(other.m_cold, nullptr)},
+        m_allocator{other.m_allocator} {}
+
+  /**
+   * @brief Copy assign every element of other, keeping the allocator of this
+   * @param other SplitNamedTuple to copy
+   * @return reference to this
+   */
+  SplitNamedTuple& operator=(const SplitNamedTuple& other) {
+    if (this == &other) { return *this; }
+    m_hot = other.m_hot;
+    if (other.m_cold == nullptr) {
+      release_cold();
+    } else if (m_cold != nullptr) {
+      *m_cold = *other.m_cold;
+    } else {
+      m_cold = m_allocator.new_object<ColdTuple>(*other.m_cold);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Move assign every element of other, keeping the allocator of this; the cold block of
+   * other is taken over if both allocate from the same memory resource
+   * @param other SplitNamedTuple to move from
+   * @return reference to this
+   */
+  SplitNamedTuple& operator=(SplitNamedTuple&& other) noexcept(
+      std::is_nothrow_move_assignable_v<HotTuple> && std::is_nothrow_move_assignable_v<ColdTuple>) {
+    if (this == &other) { return *this; }
+    m_hot = std::move(other.m_hot);
+    if (m_allocator == other.m_allocator || other.m_cold == nullptr) {
+      release_cold();
+      m_cold = std::exchange(other.m_cold, nullptr);
+    } else if (m_cold != nullptr) {
+      *m_cold = std::move(*other.m_cold);
+    } else {
+      m_cold = m_allocator.new_object<ColdTuple>(std::move(*other.m_cold));
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Destroy this SplitNamedTuple and deallocate its cold block
+   */
+  ~SplitNamedTuple() { release_cold(); }
+
+  /**
+   * @brief Get the allocator of the cold block
+   * @return the allocator
+   */
+  [[nodiscard]] allocator_type get_allocator() const noexcept { return m_allocator; }
+
+  /**
+   * @brief Check whether the cold block is allocated
+   * @return true if the cold block is allocated; otherwise false
+   */
+  [[nodiscard]] bool cold_loaded() const noexcept { return m_cold != nullptr; }
+
+  /**
+   * @brief Get the hot elements
+   * @return a reference to the inline NamedTuple of the hot elements
+   */
+  [[nodiscard]] HotTuple& hot() noexcept { return m_hot; }
+
+  /**
+   * @brief Get the hot elements
+   * @return a const reference to the inline NamedTuple of the hot elements
+   */
+  [[nodiscard]] const HotTuple& hot() const noexcept { return m_hot; }
+
+  /**
+   * @brief Get the cold elements, allocating the cold block if it is not allocated yet
+   * @return a reference to the NamedTuple of the cold elements
+   */
+  [[nodiscard]] ColdTuple& cold() {
+    if (m_cold == nullptr) { m_cold = m_allocator.new_object<ColdTuple>(); }
+    return *m_cold;
+  }
+
+  /**
+   * @brief Get the cold elements
+   * @return a const reference to the NamedTuple of the cold elements, or to value initialized
+   * elements if the cold block is not allocated
+   */
+  [[nodiscard]] const ColdTuple& cold() const noexcept {
+    return m_cold != nullptr ? *m_cold : empty_cold();
+  }
+
+  /**
+   * @brief Set the element with the name Tag to value
+   * @tparam Tag StringLiteral element name
+   * @tparam Value type of value, convertible to the type of the element associated with Tag
+   * @param value value to set
+   */
+  template <StringLiteral Tag, typename Value>
+    requires(is_one_of_v<Tag, NamedTypes...> &&
+             std::is_convertible_v<Value, std::tuple_element_t<key_index_v<Tag, NamedTypes...>,
+                                                               typename Full::Base>>)
+  void set(Value&& value) {
+    get<Tag>() = std::forward<Value>(value);
+  }
+
+  /**
+   * @brief Extracts the element whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @return the element whose name is Tag
+   */
+  template <StringLiteral Tag>
+    requires(is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] auto& get() & {
+    return get<key_index_v<Tag, NamedTypes...>>();
+  }
+
+  /**
+   * @brief Extracts the element whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @return the element whose name is Tag
+   */
+  template <StringLiteral Tag>
+    requires(is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] const auto& get() const& noexcept {
+    return get<key_index_v<Tag, NamedTypes...>>();
+  }
+
+  /**
+   * @brief Extracts the element whose name is Tag
+   * @tparam Tag a StringLiteral to search for
+   * @return the element whose name is Tag
+   */
+  template <StringLiteral Tag>
+    requires(is_one_of_v<Tag, NamedTypes...>)
+  [[nodiscard]] auto&& get() && {
+    return std::move(*this).template get<key_index_v<Tag, NamedTypes...>>();
+  }
+
+  /**
+   * @brief Extracts the element whose index is Index in declared order
+   * @tparam Index index of the element to get
+   * @return the element whose index is Index
+   */
+  template <std::size_t Index>
+    requires(Index < sizeof...(NamedTypes))
+  [[nodiscard]] auto& get() & {
+    if constexpr (Split::kHot[Index]) {
+      return m_hot.template get<Split::kPositions[Index]>();
+    } else {
+      return cold().template get<Split::kPositions[Index]>();
+    }
+  }
+
+  /**
+   * @brief Extracts the element whose index is Index in declared order
+   * @tparam Index index of the element to get
+   * @return the element whose index is Index
+   */
+  template <std::size_t Index>
+    requires(Index < sizeof...(NamedTypes))
+  [[nodiscard]] const auto& get() const& noexcept {
+    if constexpr (Split::kHot[Index]) {
+      return m_hot.template get<Split::kPositions[Index]>();
+    } else {
+      return cold().template get<Split::kPositions[Index]>();
+    }
+  }
+
+  /**
+   * @brief Extracts the element whose index is Index in declared order
+   * @tparam Index index of the element to get
+   * @return the element whose index is Index
+   */
+  template <std::size_t Index>
+    requires(Index < sizeof...(NamedTypes))
+  [[nodiscard]] auto&& get() && {
+    if constexpr (Split::kHot[Index]) {
+      return std::move(m_hot).template get<Split::kPositions[Index]>();
+    } else {
+      return std::move(cold()).template get<Split::kPositions[Index]>();
+    }
+  }
+
+  /**
+   * @brief Copy every element into a NamedTuple
+   * @return a NamedTuple holding copies of the elements in declared order
+   */
+  [[nodiscard]] Full to_tuple() const {
+    return [this]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+      return Full{get<Indices>()...};
+    }(std::index_sequence_for<NamedTypes...>{});
+  }
+
+  /**
+   * @brief Equality compare every element of this and other, an unallocated cold block compares
+   * like value initialized elements
+   * @param other SplitNamedTuple to compare with
+   * @return true if all elements are equal; otherwise false
+   */
+  [[nodiscard]] bool operator==(const SplitNamedTuple& other) const {
+    return m_hot == other.m_hot && cold() == other.cold();
+  }
+
+  /**
+   * @brief Lexicographically compare the elements of this and other in declared order
+   * @param other SplitNamedTuple to compare with
+   * @return The relation between the first pair of non-equivalent elements if there is any,
+   * otherwise equivalent
+   */
+  [[nodiscard]] auto operator<=>(const SplitNamedTuple& other) const {
+    return compare_by<NamedTypes{}.tag()...>(*this, other);
+  }
+
+private:
+  template <bool IsHot, typename Part, typename Source>
+  [[nodiscard]] static Part part(Source&& full, const allocator_type& alloc) {
+    return [&full, &alloc]<std::size_t... Positions>(std::index_sequence<Positions...>) {
+      if constexpr (sizeof...(Positions) == 0) {
+        return Part{std::allocator_arg, alloc};
+      } else {
+        return Part{std::allocator_arg, alloc,
+                    std::forward<Source>(full)
+                        .template get<Split::template kSources<IsHot>[Positions]>()...};
+      }
+    }(std::make_index_sequence<std::tuple_size_v<Part>>{});
+  }
+
+  [[nodiscard]] static const ColdTuple& empty_cold() noexcept {
+    static const ColdTuple kEmpty{};
+    return kEmpty;
+  }
+
+  void release_cold() noexcept {
+    if (m_cold != nullptr) { m_allocator.delete_object(std::exchange(m_cold, nullptr)); }
+  }
+
+  HotTuple m_hot;
+  ColdTuple* m_cold{nullptr};
+  allocator_type m_allocator;
+};
+}  // namespace mguid
+
+// NOLINTBEGIN(cert-dcl58-cpp)
+namespace std {
+/**
+ * @brief Specialization of std::tuple_size for SplitNamedTuple
+ * @tparam Hot HotTags of the elements stored inline
+ * @tparam NamedTypes type list for a SplitNamedTuple
+ */
+template <typename Hot, typename... NamedTypes>
+struct tuple_size<mguid::SplitNamedTuple<Hot, NamedTypes...>>
+    : std::integral_constant<std::size_t, sizeof...(NamedTypes)> {};
+
+/**
+ * @brief Specialization of std::tuple_element for SplitNamedTuple
+ * @tparam Index index of the element
+ * @tparam Hot HotTags of the elements stored inline
+ * @tparam NamedTypes type list for a SplitNamedTuple
+ */
+template <std::size_t Index, typename Hot, typename... NamedTypes>
+struct tuple_element<Index, mguid::SplitNamedTuple<Hot, NamedTypes...>> {
+  using type = std::tuple_element_t<Index, typename mguid::NamedTuple<NamedTypes...>::Base>;
+};
+}  // namespace std
+// NOLINTEND(cert-dcl58-cpp)
+
+#endif  // MGUID_SPLITNAMEDTUPLE_H
@@ -27,6 +27,12 @@ class TestCompilationSanityChecks(unittest.TestCase):
     def test_same_size_comparison(self):
         self.assertTrue(self.compiler.compiles("tests/same_size_comparison.cpp"))
 
+    def test_concat_duplicate_tags(self):
+        self.assertTrue(self.compiler.compile_fails("tests/concat_duplicate_tags.cpp"))
+
+    def test_merge_with_override(self):
+        self.assertTrue(self.compiler.compiles("tests/merge_with_override.cpp"))
+
     @classmethod
     def tearDownClass(cls):
         cls.compiler.cleanup()
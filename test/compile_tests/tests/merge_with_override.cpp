@@ -0,0 +1,10 @@
+#include "NamedTuple.hpp"
+
+#include <tuple>
+
+int main() {
+  mguid::NamedTuple<mguid::NamedType<"key1", int>, mguid::NamedType<"key2", int>> nt1{0, 1};
+  mguid::NamedTuple<mguid::NamedType<"key2", int>> nt2{2};
+
+  [[maybe_unused]] auto merged = mguid::merge_with_override(nt1, nt2);
+}
@@ -0,0 +1,102 @@
+#include "NamedTuple.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if !defined(NAMED_TUPLE_ACCESS_COUNTERS)
+#error "the access counter tests must be compiled with NAMED_TUPLE_ACCESS_COUNTERS defined"
+#endif
+
+namespace {
+using Order = mguid::NamedTuple<mguid::NamedType<"id", std::uint64_t>,
+                                mguid::NamedType<"symbol", std::string>,
+                                mguid::NamedType<"price", double>, mguid::NamedType<"qty", int>>;
+
+std::atomic<std::uint64_t> hooked_sets{0};
+
+void count_sets(std::string_view name, std::size_t index, mguid::FieldAccess access) noexcept {
+  if (access == mguid::FieldAccess::kSet && name == "qty" && index == 3) {
+    hooked_sets.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+constexpr int constant_qty() {
+  mguid::NamedTuple<mguid::NamedType<"qty", int>> order{2};
+  order.set<"qty">(order.get<"qty">() + 1);
+  return order.get<"qty">();
+}
+}  // namespace
+
+TEST_CASE("Access Counters") {
+  mguid::reset_access_counts<Order>();
+  Order order{1U, "ABC", 10.0, 100};
+  const Order& const_order = order;
+
+  SECTION("Counts Gets And Sets By Tag") {
+    order.set<"qty">(200);
+    order.set<"qty">(300);
+    order.get<"price">() += 1.0;
+    [[maybe_unused]] const auto& symbol = const_order.get<"symbol">();
+    [[maybe_unused]] auto moved = std::move(order).get<"symbol">();
+    const auto counts = mguid::access_counts<Order>();
+    REQUIRE(counts.size() == 4);
+    REQUIRE(counts[0].name == "id");
+    REQUIRE(counts[0].gets == 0);
+    REQUIRE(counts[1].name == "symbol");
+    REQUIRE(counts[1].gets == 2);
+    REQUIRE(counts[2].name == "price");
+    REQUIRE(counts[2].gets == 1);
+    REQUIRE(counts[3].name == "qty");
+    REQUIRE(counts[3].gets == 0);
+    REQUIRE(counts[3].sets == 2);
+  }
+  SECTION("Does Not Count By Index") {
+    order.get<0>() = 7U;
+    [[maybe_unused]] const auto copy = order;
+    const auto counts = mguid::access_counts<Order>();
+    for (const auto& count : counts) {
+      REQUIRE(count.gets == 0);
+      REQUIRE(count.sets == 0);
+    }
+  }
+  SECTION("Reset") {
+    order.set<"id">(2U);
+    REQUIRE(mguid::access_counts<Order>()[0].sets == 1);
+    mguid::reset_access_counts<Order>();
+    REQUIRE(mguid::access_counts<Order>()[0].sets == 0);
+  }
+  SECTION("Hook") {
+    hooked_sets = 0;
+    REQUIRE(mguid::set_access_hook(count_sets) == nullptr);
+    order.set<"qty">(1);
+    order.set<"qty">(2);
+    order.set<"price">(1.0);
+    REQUIRE(mguid::set_access_hook(nullptr) == count_sets);
+    order.set<"qty">(3);
+    REQUIRE(hooked_sets == 2);
+    REQUIRE(mguid::access_counts<Order>()[3].sets == 3);
+  }
+  SECTION("Threads") {
+    constexpr std::size_t kThreads{4};
+    constexpr std::uint64_t kGets{10'000};
+    std::vector<double> totals(kThreads);
+    std::vector<std::thread> threads;
+    for (std::size_t thread{0}; thread < kThreads; ++thread) {
+      threads.emplace_back([&const_order, &total = totals[thread]] {
+        for (std::uint64_t index{0}; index < kGets; ++index) { total += const_order.get<"price">(); }
+      });
+    }
+    for (auto& thread : threads) { thread.join(); }
+    for (const double total : totals) { REQUIRE(total == 100'000.0); }
+    REQUIRE(mguid::access_counts<Order>()[2].gets == kThreads * kGets);
+  }
+}
+
+TEST_CASE("Access Counters In Constant Evaluation") { STATIC_REQUIRE(constant_qty() == 3); }
@@ -0,0 +1,92 @@
+#include "AtomicNamedTuple.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using Counters = mguid::AtomicNamedTuple<mguid::NamedType<"requests", std::uint64_t>,
+                                         mguid::NamedType<"errors", std::uint32_t>,
+                                         mguid::NamedType<"ratio", double>>;
+using PaddedCounters = mguid::PaddedAtomicNamedTuple<mguid::NamedType<"requests", std::uint64_t>,
+                                                     mguid::NamedType<"errors", std::uint32_t>,
+                                                     mguid::NamedType<"ratio", double>>;
+
+template <typename Atomic>
+concept CanFetchAddRatio = requires(Atomic& atomic) { atomic.template fetch_add<"ratio">(1.0); };
+
+template <typename Atomic>
+concept CanLoadMissing = requires(const Atomic& atomic) { atomic.template load<"missing">(); };
+
+TEST_CASE("Atomic NamedTuple Layout") {
+  SECTION("Unpadded Elements Are Adjacent") {
+    REQUIRE(sizeof(Counters) <= 2 * mguid::kCacheLineSize);
+    REQUIRE(sizeof(Counters) == sizeof(std::tuple<std::atomic<std::uint64_t>,
+                                                  std::atomic<std::uint32_t>, std::atomic<double>>));
+  }
+  SECTION("Padded Elements Have A Cache Line Each") {
+    REQUIRE(alignof(PaddedCounters) == mguid::kCacheLineSize);
+    REQUIRE(sizeof(PaddedCounters) == 3 * mguid::kCacheLineSize);
+    const PaddedCounters counters{};
+    const auto requests = reinterpret_cast<std::uintptr_t>(&counters.atomic<"requests">());
+    const auto errors = reinterpret_cast<std::uintptr_t>(&counters.atomic<"errors">());
+    REQUIRE(requests % mguid::kCacheLineSize == 0);
+    REQUIRE(errors % mguid::kCacheLineSize == 0);
+    REQUIRE(requests != errors);
+  }
+  SECTION("Traits") {
+    STATIC_REQUIRE(Counters::size() == 3);
+    STATIC_REQUIRE(Counters::is_always_lock_free);
+    STATIC_REQUIRE_FALSE(std::is_copy_constructible_v<Counters>);
+    STATIC_REQUIRE(CanFetchAddRatio<Counters>);
+    STATIC_REQUIRE_FALSE(CanLoadMissing<Counters>);
+  }
+}
+
+TEST_CASE("Atomic NamedTuple Operations") {
+  Counters counters{Counters::Snapshot{10U, 1U, 0.5}};
+
+  SECTION("Load And Store") {
+    REQUIRE(counters.load<"requests">() == 10);
+    counters.store<"errors">(4U, std::memory_order_release);
+    REQUIRE(counters.load<"errors">(std::memory_order_acquire) == 4);
+  }
+  SECTION("Read Modify Write") {
+    REQUIRE(counters.fetch_add<"requests">(5) == 10);
+    REQUIRE(counters.fetch_sub<"errors">(1U, std::memory_order_relaxed) == 1);
+    REQUIRE(counters.fetch_add<"ratio">(0.25) == 0.5);
+    REQUIRE(counters.exchange<"requests">(1) == 15);
+    std::uint32_t expected{7};
+    REQUIRE_FALSE(counters.compare_exchange<"errors">(expected, 9U));
+    REQUIRE(expected == 0);
+    REQUIRE(counters.compare_exchange<"errors">(expected, 9U));
+    REQUIRE(counters.snapshot() == Counters::Snapshot{1U, 9U, 0.75});
+  }
+  SECTION("Default Construction Value Initializes") {
+    const PaddedCounters padded{};
+    REQUIRE(padded.snapshot() == PaddedCounters::Snapshot{0U, 0U, 0.0});
+  }
+}
+
+TEST_CASE("Atomic NamedTuple Concurrent Updates") {
+  constexpr std::size_t kThreads{4};
+  constexpr std::uint64_t kIncrements{10'000};
+  PaddedCounters counters{};
+  std::vector<std::thread> threads{};
+  for (std::size_t thread{0}; thread < kThreads; ++thread) {
+    threads.emplace_back([&counters] {
+      for (std::uint64_t i{0}; i < kIncrements; ++i) {
+        counters.fetch_add<"requests">(1, std::memory_order_relaxed);
+        if (i % 10 == 0) { counters.fetch_add<"errors">(1U, std::memory_order_relaxed); }
+      }
+    });
+  }
+  for (auto& thread : threads) { thread.join(); }
+  const auto snapshot = counters.snapshot();
+  REQUIRE(snapshot.get<"requests">() == kThreads * kIncrements);
+  REQUIRE(snapshot.get<"errors">() == kThreads * kIncrements / 10);
+}
@@ -0,0 +1,95 @@
+#include "BitPackedNamedTuple.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <compare>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace {
+enum class Side : std::uint8_t { kBuy, kSell };
+enum class Venue : std::int8_t { kDark = -2, kLit = 1 };
+}  // namespace
+
+using Order = mguid::BitPackedNamedTuple<mguid::NamedType<"side", mguid::Bits<Side, 1>>,
+                                         mguid::NamedType<"price", double>,
+                                         mguid::NamedType<"venue", mguid::Bits<Venue, 3>>,
+                                         mguid::NamedType<"count", mguid::Bits<std::uint16_t, 12>>,
+                                         mguid::NamedType<"delta", mguid::Bits<int, 5>>,
+                                         mguid::NamedType<"live", mguid::Bits<bool, 1>>>;
+
+TEST_CASE("BitPackedNamedTuple Layout") {
+  STATIC_REQUIRE(std::is_same_v<Order::Word, std::uint32_t>);
+  STATIC_REQUIRE(std::tuple_size_v<Order::Words> == 1);
+  STATIC_REQUIRE(sizeof(Order) == 16);
+  STATIC_REQUIRE(Order::is_bit_field<"side">());
+  STATIC_REQUIRE(!Order::is_bit_field<"price">());
+  STATIC_REQUIRE(std::is_same_v<decltype(std::declval<const Order&>().get<"count">()),
+                                std::uint16_t>);
+  STATIC_REQUIRE(std::is_same_v<decltype(std::declval<Order&>().get<"price">()), double&>);
+
+  using Wide = mguid::BitPackedNamedTuple<mguid::NamedType<"a", mguid::Bits<std::uint64_t, 40>>,
+                                          mguid::NamedType<"b", mguid::Bits<std::uint64_t, 40>>>;
+  STATIC_REQUIRE(std::tuple_size_v<Wide::Words> == 2);
+  Wide wide{std::uint64_t{1} << 39, (std::uint64_t{1} << 40) - 1};
+  REQUIRE(wide.get<"a">() == std::uint64_t{1} << 39);
+  REQUIRE(wide.get<"b">() == (std::uint64_t{1} << 40) - 1);
+}
+
+TEST_CASE("BitPackedNamedTuple Access") {
+  SECTION("Default") {
+    constexpr Order order;
+    STATIC_REQUIRE(order.get<"side">() == Side::kBuy);
+    STATIC_REQUIRE(order.get<"count">() == 0);
+    STATIC_REQUIRE(!order.get<"live">());
+  }
+  SECTION("Construct") {
+    const Order order{Side::kSell, 1.5, Venue::kDark, std::uint16_t{4095}, -16, true};
+    REQUIRE(order.get<"side">() == Side::kSell);
+    REQUIRE(order.get<"price">() == 1.5);
+    REQUIRE(order.get<"venue">() == Venue::kDark);
+    REQUIRE(order.get<"count">() == 4095);
+    REQUIRE(order.get<"delta">() == -16);
+    REQUIRE(order.get<"live">());
+    REQUIRE(Order{order.to_tuple()} == order);
+  }
+  SECTION("Set Is A Masked Write") {
+    Order order;
+    order.set<"count">(std::uint16_t{0xFFFF});
+    REQUIRE(order.get<"count">() == 0xFFF);
+    REQUIRE(order.get<"side">() == Side::kBuy);
+    REQUIRE(order.get<"delta">() == 0);
+
+    order.set<"delta">(15);
+    order.set<"venue">(Venue::kLit);
+    REQUIRE(order.get<"delta">() == 15);
+    REQUIRE(order.get<"count">() == 0xFFF);
+    REQUIRE(order.get<"venue">() == Venue::kLit);
+  }
+  SECTION("Proxy") {
+    Order order;
+    auto count = order.get<"count">();
+    count = 17;
+    REQUIRE(order.get<"count">() == 17);
+    order.get<"delta">() = order.get<"count">();
+    REQUIRE(static_cast<int>(order.get<"delta">()) == -15);
+    order.get<"price">() = 3.0;
+    REQUIRE(std::as_const(order).get<"price">() == 3.0);
+  }
+}
+
+TEST_CASE("BitPackedNamedTuple Comparison") {
+  const Order lhs{Side::kBuy, 1.0, Venue::kLit, std::uint16_t{3}, -1, false};
+  Order rhs{lhs};
+  REQUIRE(lhs == rhs);
+  REQUIRE((lhs <=> rhs) == std::partial_ordering::equivalent);
+
+  rhs.set<"delta">(0);
+  REQUIRE(lhs != rhs);
+  REQUIRE(lhs < rhs);
+
+  rhs.set<"side">(Side::kSell);
+  rhs.set<"delta">(-5);
+  REQUIRE(lhs < rhs);
+}
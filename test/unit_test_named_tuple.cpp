@@ -2,8 +2,14 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <any>
+#include <array>
+#include <compare>
+#include <cstddef>
 #include <cstdint>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 
@@ -227,4 +233,697 @@ TEST_CASE("Specialization of std::tuple_size") {
                 mguid::NamedTuple<mguid::NamedType<"test1", int>, mguid::NamedType<"test2", int>,
                                   mguid::NamedType<"test3", int>>> == 3);
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Tag Lookup") {
+  SECTION("Key Index") {
+    STATIC_REQUIRE(mguid::key_index_v<"alpha", mguid::NamedType<"alpha", int>,
+                                      mguid::NamedType<"beta", char>> == 0);
+    STATIC_REQUIRE(mguid::key_index_v<"beta", mguid::NamedType<"alpha", int>,
+                                      mguid::NamedType<"beta", char>> == 1);
+    STATIC_REQUIRE(mguid::key_index<"gamma", mguid::NamedType<"alpha", int>{},
+                                    mguid::NamedType<"beta", char>{},
+                                    mguid::NamedType<"gamma", float>{}>() == 2);
+    STATIC_REQUIRE(mguid::key_index<mguid::NamedType<"beta", int>{},
+                                    mguid::NamedType<"alpha", int>{},
+                                    mguid::NamedType<"beta", char>{}>() == 1);
+  }
+  SECTION("Missing Key") {
+    STATIC_REQUIRE(mguid::key_index_v<"missing", mguid::NamedType<"alpha", int>> == 1);
+    STATIC_REQUIRE_FALSE(mguid::is_one_of_v<"missing", mguid::NamedType<"alpha", int>>);
+    STATIC_REQUIRE_FALSE(mguid::is_one_of<"alph", mguid::NamedType<"alpha", int>{}>());
+    STATIC_REQUIRE(mguid::is_one_of<"alpha", mguid::NamedType<"alpha", int>{}>());
+  }
+  SECTION("Uniqueness") {
+    STATIC_REQUIRE(mguid::all_unique<>());
+    STATIC_REQUIRE(mguid::all_unique_v<mguid::NamedType<"a", int>, mguid::NamedType<"b", int>,
+                                       mguid::NamedType<"ab", int>>);
+    STATIC_REQUIRE_FALSE(mguid::all_unique_v<mguid::NamedType<"a", int>,
+                                             mguid::NamedType<"b", int>,
+                                             mguid::NamedType<"a", char>>);
+    STATIC_REQUIRE_FALSE(
+        mguid::all_unique<mguid::NamedType<"a", int>{}, mguid::NamedType<"a", int>{}>());
+  }
+  SECTION("Hash") {
+    STATIC_REQUIRE(mguid::fnv1a_hash("") == 0xcbf29ce484222325ULL);
+    STATIC_REQUIRE(mguid::fnv1a_hash("a") == 0xaf63dc4c8601ec8cULL);
+  }
+  SECTION("Every Element Of A Wide Tuple") {
+    mguid::NamedTuple<mguid::NamedType<"f0", int>, mguid::NamedType<"f1", int>,
+                      mguid::NamedType<"f2", int>, mguid::NamedType<"f3", int>,
+                      mguid::NamedType<"f4", int>, mguid::NamedType<"f5", int>,
+                      mguid::NamedType<"f6", int>, mguid::NamedType<"f7", int>,
+                      mguid::NamedType<"f8", int>, mguid::NamedType<"f9", int>>
+        nt{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    REQUIRE(nt.get<"f0">() == 0);
+    REQUIRE(nt.get<"f3">() == 3);
+    REQUIRE(nt.get<"f7">() == 7);
+    REQUIRE(nt.get<"f9">() == 9);
+  }
+}
+
+TEST_CASE("Run Time Name Lookup") {
+  using Record =
+      mguid::NamedTuple<mguid::NamedType<"id", int>, mguid::NamedType<"name", std::string>,
+                        mguid::NamedType<"price", double>, mguid::NamedType<"qty", std::int64_t>>;
+  Record record{1, "widget", 2.5, std::int64_t{10}};
+
+  SECTION("Index Of") {
+    REQUIRE(record.index_of("id") == 0);
+    REQUIRE(record.index_of("name") == 1);
+    REQUIRE(record.index_of("price") == 2);
+    REQUIRE(Record::index_of("qty") == 3);
+    REQUIRE_FALSE(record.index_of("missing").has_value());
+    REQUIRE_FALSE(record.index_of("").has_value());
+    REQUIRE_FALSE(record.index_of("pric").has_value());
+    STATIC_REQUIRE(Record::index_of("price") == 2);
+  }
+  SECTION("Empty") { REQUIRE_FALSE(mguid::NamedTuple<>::index_of("id").has_value()); }
+  SECTION("Visit By Name") {
+    const bool visited = record.visit_by_name("qty", [](auto& value) {
+      if constexpr (std::is_same_v<std::remove_cvref_t<decltype(value)>, std::int64_t>) {
+        value = 42;
+      }
+    });
+    REQUIRE(visited);
+    REQUIRE(record.get<"qty">() == 42);
+    REQUIRE_FALSE(record.visit_by_name("missing", [](auto&) { FAIL(); }));
+  }
+  SECTION("Visit Const") {
+    const Record& const_record = record;
+    std::string visited_name;
+    const_record.visit_by_name("name", [&visited_name](const auto& value) {
+      if constexpr (std::is_same_v<std::remove_cvref_t<decltype(value)>, std::string>) {
+        visited_name = value;
+      }
+    });
+    REQUIRE(visited_name == "widget");
+  }
+  SECTION("Visit By Index") {
+    double price{0.0};
+    REQUIRE(record.visit_by_index(2, [&price](const auto& value) {
+      if constexpr (std::is_arithmetic_v<std::remove_cvref_t<decltype(value)>>) {
+        price = static_cast<double>(value);
+      }
+    }));
+    REQUIRE(price == 2.5);
+    REQUIRE_FALSE(record.visit_by_index(4, [](const auto&) {}));
+  }
+  SECTION("Many Fields") {
+    mguid::NamedTuple<mguid::NamedType<"f0", int>, mguid::NamedType<"f1", int>,
+                      mguid::NamedType<"f2", int>, mguid::NamedType<"f3", int>,
+                      mguid::NamedType<"f4", int>, mguid::NamedType<"f5", int>,
+                      mguid::NamedType<"f6", int>, mguid::NamedType<"f7", int>,
+                      mguid::NamedType<"f8", int>, mguid::NamedType<"f9", int>,
+                      mguid::NamedType<"f10", int>, mguid::NamedType<"f11", int>>
+        wide{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    constexpr std::array<std::string_view, 12> kNames{"f0", "f1", "f2", "f3", "f4",  "f5",
+                                                      "f6", "f7", "f8", "f9", "f10", "f11"};
+    for (int i{0}; i < 12; ++i) {
+      int value{-1};
+      REQUIRE(wide.visit_by_name(kNames[static_cast<std::size_t>(i)],
+                                 [&value](int element) { value = element; }));
+      REQUIRE(value == i);
+    }
+  }
+}
+
+TEST_CASE("Schema Hash") {
+  using Record = mguid::NamedTuple<mguid::NamedType<"id", std::int32_t>,
+                                   mguid::NamedType<"price", double>>;
+
+  SECTION("Usable At Compile Time") {
+    static_assert(mguid::schema_hash_v<Record> != 0);
+    REQUIRE(std::is_same_v<decltype(mguid::schema_hash_v<Record>), const std::uint64_t>);
+  }
+  SECTION("Same Schema Same Hash") {
+    using Same = mguid::NamedTuple<mguid::NamedType<"id", std::int32_t>,
+                                   mguid::NamedType<"price", double>>;
+    REQUIRE(mguid::schema_hash_v<Record> == mguid::schema_hash_v<Same>);
+  }
+  SECTION("Different Tag") {
+    using Renamed = mguid::NamedTuple<mguid::NamedType<"id", std::int32_t>,
+                                      mguid::NamedType<"cost", double>>;
+    REQUIRE(mguid::schema_hash_v<Record> != mguid::schema_hash_v<Renamed>);
+  }
+  SECTION("Different Type Of The Same Size") {
+    using Retyped = mguid::NamedTuple<mguid::NamedType<"id", std::uint32_t>,
+                                      mguid::NamedType<"price", double>>;
+    REQUIRE(mguid::schema_hash_v<Record> != mguid::schema_hash_v<Retyped>);
+  }
+  SECTION("Different Order") {
+    using Reordered = mguid::NamedTuple<mguid::NamedType<"price", double>,
+                                        mguid::NamedType<"id", std::int32_t>>;
+    REQUIRE(mguid::schema_hash_v<Record> != mguid::schema_hash_v<Reordered>);
+  }
+  SECTION("Empty") {
+    REQUIRE(mguid::schema_hash_v<mguid::NamedTuple<>> != mguid::schema_hash_v<Record>);
+  }
+  SECTION("Scalars Hash By Kind And Size") {
+    enum class Side : std::uint8_t { kBuy, kSell };
+    using Spelled = mguid::NamedTuple<mguid::NamedType<"wide", long>>;
+    using Respelled = mguid::NamedTuple<mguid::NamedType<"wide", long long>>;
+    REQUIRE((sizeof(long) != sizeof(long long) ||
+             mguid::schema_hash_v<Spelled> == mguid::schema_hash_v<Respelled>));
+    REQUIRE(mguid::type_hash<Side>() != mguid::type_hash<std::uint8_t>());
+    REQUIRE(mguid::type_hash<std::array<char, 4>>() == mguid::type_hash<char[4]>());
+    REQUIRE(mguid::type_hash<std::array<char, 4>>() != mguid::type_hash<std::array<char, 8>>());
+    REQUIRE(mguid::type_hash<const double>() == mguid::type_hash<double>());
+  }
+  SECTION("Type Name") {
+    STATIC_REQUIRE(mguid::type_name<int>() == "int");
+    STATIC_REQUIRE(mguid::type_name<double>() == "double");
+  }
+}
+
+namespace {
+struct CopyCounter {
+  static inline int copies{0};
+  static inline int moves{0};
+
+  static void reset() {
+    copies = 0;
+    moves = 0;
+  }
+
+  CopyCounter() = default;
+  CopyCounter(int init_a, int init_b) : a{init_a}, b{init_b} {}
+  CopyCounter(const CopyCounter& other) : a{other.a}, b{other.b} { ++copies; }
+  CopyCounter(CopyCounter&& other) noexcept : a{other.a}, b{other.b} { ++moves; }
+  CopyCounter& operator=(const CopyCounter&) = default;
+  CopyCounter& operator=(CopyCounter&&) noexcept = default;
+  ~CopyCounter() = default;
+
+  int a{0};
+  int b{0};
+};
+}  // namespace
+
+TEST_CASE("Make Tuple Forwarding") {
+  SECTION("Element Types") {
+    int i{5};
+    const std::string str{"str"};
+    auto nt = mguid::make_tuple(mguid::NamedTypeV<"ref">(std::ref(i)),
+                                mguid::NamedTypeV<"lvalue">(str),
+                                mguid::NamedTypeV<"rvalue">(std::string{"rvalue"}));
+    REQUIRE(std::is_same_v<std::tuple_element_t<0, decltype(nt)>, int&>);
+    REQUIRE(std::is_same_v<std::tuple_element_t<1, decltype(nt)>, std::string>);
+    REQUIRE(std::is_same_v<std::tuple_element_t<2, decltype(nt)>, std::string>);
+    REQUIRE(&nt.get<"ref">() == &i);
+    REQUIRE(nt.get<"lvalue">() == "str");
+    REQUIRE(nt.get<"rvalue">() == "rvalue");
+  }
+  SECTION("Rvalue Is Moved Into The Helper And Never Copied") {
+    CopyCounter::reset();
+    auto nt = mguid::make_tuple(mguid::NamedTypeV<"counter">(CopyCounter{1, 2}));
+    REQUIRE(CopyCounter::copies == 0);
+    REQUIRE(CopyCounter::moves == 2);
+    REQUIRE(nt.get<"counter">().b == 2);
+  }
+  SECTION("Stored Helper Owns An Rvalue") {
+    using Named = mguid::NamedTuple<mguid::NamedType<"s", std::string>>;
+    const auto helper = mguid::NamedTypeV<"s">(std::string(32, 'x'));
+    REQUIRE(std::is_same_v<std::remove_cvref_t<decltype(helper.value)>, std::string>);
+    const Named first{helper};
+    const Named second{helper};
+    REQUIRE(first.get<"s">() == std::string(32, 'x'));
+    REQUIRE(second == first);
+  }
+  SECTION("Lvalue Is Copied Once") {
+    const CopyCounter counter{3, 4};
+    CopyCounter::reset();
+    auto nt = mguid::make_tuple(mguid::NamedTypeV<"counter">(counter));
+    REQUIRE(CopyCounter::copies == 1);
+    REQUIRE(CopyCounter::moves == 0);
+    REQUIRE(nt.get<"counter">().a == 3);
+  }
+  SECTION("Emplace Constructs In Place") {
+    CopyCounter::reset();
+    auto nt = mguid::make_tuple(mguid::NamedTypeEmplace<"counter", CopyCounter>(5, 6),
+                                mguid::NamedTypeEmplace<"str", std::string>(std::size_t{3}, 'x'));
+    REQUIRE(std::is_same_v<std::tuple_element_t<0, decltype(nt)>, CopyCounter>);
+    REQUIRE(CopyCounter::copies == 0);
+    REQUIRE(CopyCounter::moves == 0);
+    REQUIRE(nt.get<"counter">().a == 5);
+    REQUIRE(nt.get<"str">() == "xxx");
+  }
+  SECTION("Constructor Forwards Rvalues") {
+    CopyCounter::reset();
+    mguid::NamedTuple<mguid::NamedType<"counter", CopyCounter>> nt{CopyCounter{7, 8}};
+    REQUIRE(CopyCounter::copies == 0);
+    REQUIRE(CopyCounter::moves == 1);
+    REQUIRE(nt.get<"counter">().a == 7);
+  }
+}
+
+TEST_CASE("Named Construction") {
+  using Record =
+      mguid::NamedTuple<mguid::NamedType<"id", int>, mguid::NamedType<"name", std::string>,
+                        mguid::NamedType<"price", double>>;
+
+  SECTION("Any Order") {
+    const Record record{mguid::NamedTypeV<"price">(2.5), mguid::NamedTypeV<"id">(7),
+                        mguid::NamedTypeV<"name">(std::string{"widget"})};
+    REQUIRE(record.get<"id">() == 7);
+    REQUIRE(record.get<"name">() == "widget");
+    REQUIRE(record.get<"price">() == 2.5);
+  }
+  SECTION("Missing Fields Are Value Initialized") {
+    const Record record{mguid::NamedTypeV<"name">(std::string{"widget"})};
+    REQUIRE(record.get<"id">() == 0);
+    REQUIRE(record.get<"name">() == "widget");
+    REQUIRE(record.get<"price">() == 0.0);
+  }
+  SECTION("Emplace") {
+    const Record record{mguid::NamedTypeEmplace<"name", std::string>(std::size_t{2}, 'z'),
+                        mguid::NamedTypeV<"id">(1)};
+    REQUIRE(record.get<"name">() == "zz");
+  }
+  SECTION("Each Field Constructed Once") {
+    using Counted = mguid::NamedTuple<mguid::NamedType<"first", CopyCounter>,
+                                      mguid::NamedType<"second", CopyCounter>,
+                                      mguid::NamedType<"third", CopyCounter>>;
+    CopyCounter lvalue{1, 1};
+    CopyCounter::reset();
+    const Counted counted{mguid::NamedTypeV<"third">(CopyCounter{3, 3}),
+                          mguid::NamedTypeV<"first">(lvalue)};
+    REQUIRE(CopyCounter::copies == 1);
+    REQUIRE(CopyCounter::moves == 2);
+    REQUIRE(counted.get<"first">().a == 1);
+    REQUIRE(counted.get<"second">().a == 0);
+    REQUIRE(counted.get<"third">().a == 3);
+  }
+  SECTION("Only Valid Names") {
+    REQUIRE(std::is_constructible_v<Record, decltype(mguid::NamedTypeV<"id">(1))>);
+    REQUIRE_FALSE(std::is_constructible_v<Record, decltype(mguid::NamedTypeV<"missing">(1))>);
+    REQUIRE_FALSE(std::is_constructible_v<Record, decltype(mguid::NamedTypeV<"id">(1)),
+                                          decltype(mguid::NamedTypeV<"id">(2))>);
+  }
+  SECTION("Positional Construction Still Works") {
+    const Record record{1, std::string{"positional"}, 0.5};
+    REQUIRE(record.get<"name">() == "positional");
+  }
+  SECTION("Elements Constructible From Anything") {
+    using Extra =
+        mguid::NamedTuple<mguid::NamedType<"id", int>, mguid::NamedType<"extra", std::any>>;
+    const Extra missing{mguid::NamedTypeV<"id">(1)};
+    REQUIRE_FALSE(missing.get<"extra">().has_value());
+    const Extra emplaced{mguid::NamedTypeEmplace<"extra", std::any>(std::string{"value"})};
+    REQUIRE(std::any_cast<std::string>(emplaced.get<"extra">()) == "value");
+    const auto made = mguid::make_tuple(mguid::NamedTypeEmplace<"extra", std::any>(3));
+    REQUIRE(std::any_cast<int>(made.get<"extra">()) == 3);
+  }
+}
+
+template <typename NT, mguid::StringLiteral... Tags>
+concept CanSelect = requires(NT&& nt) { std::forward<NT>(nt).template select<Tags...>(); };
+
+template <typename NT, mguid::StringLiteral... Tags>
+concept CanDrop = requires(NT&& nt) { std::forward<NT>(nt).template drop<Tags...>(); };
+
+template <typename NT, mguid::StringLiteral From, mguid::StringLiteral To>
+concept CanRename = requires(NT&& nt) { std::forward<NT>(nt).template rename<From, To>(); };
+
+TEST_CASE("Projection") {
+  using Record =
+      mguid::NamedTuple<mguid::NamedType<"id", int>, mguid::NamedType<"name", std::string>,
+                        mguid::NamedType<"price", double>, mguid::NamedType<"qty", int>>;
+  Record record{1, std::string{"widget"}, 2.5, 10};
+  const Record& const_record = record;
+
+  SECTION("Select") {
+    auto selected = record.select<"qty", "name">();
+    REQUIRE(std::is_same_v<decltype(selected),
+                           mguid::NamedTuple<mguid::NamedType<"qty", int&>,
+                                             mguid::NamedType<"name", std::string&>>>);
+    REQUIRE(&selected.get<"name">() == &record.get<"name">());
+    selected.get<"qty">() = 11;
+    REQUIRE(record.get<"qty">() == 11);
+  }
+  SECTION("Select Const") {
+    auto selected = const_record.select<"price">();
+    REQUIRE(std::is_same_v<decltype(selected),
+                           mguid::NamedTuple<mguid::NamedType<"price", const double&>>>);
+    REQUIRE(&selected.get<"price">() == &record.get<"price">());
+  }
+  SECTION("Drop") {
+    auto remaining = record.drop<"name", "id">();
+    REQUIRE(std::is_same_v<decltype(remaining),
+                           mguid::NamedTuple<mguid::NamedType<"price", double&>,
+                                             mguid::NamedType<"qty", int&>>>);
+    REQUIRE(&remaining.get<"qty">() == &record.get<"qty">());
+    REQUIRE(std::tuple_size_v<decltype(const_record.drop<>())> == 4);
+  }
+  SECTION("Rename") {
+    auto renamed = const_record.rename<"qty", "quantity">();
+    REQUIRE(std::is_same_v<
+            decltype(renamed),
+            mguid::NamedTuple<mguid::NamedType<"id", const int&>,
+                              mguid::NamedType<"name", const std::string&>,
+                              mguid::NamedType<"price", const double&>,
+                              mguid::NamedType<"quantity", const int&>>>);
+    REQUIRE(&renamed.get<"quantity">() == &record.get<"qty">());
+  }
+  SECTION("Projection Compares With Copies") {
+    const mguid::NamedTuple<mguid::NamedType<"name", std::string>, mguid::NamedType<"id", int>>
+        expected{std::string{"widget"}, 1};
+    REQUIRE(record.select<"name", "id">() == expected);
+  }
+  SECTION("Constraints") {
+    REQUIRE(CanSelect<Record&, "id">);
+    REQUIRE_FALSE(CanSelect<Record&, "missing">);
+    REQUIRE_FALSE(CanSelect<Record&, "id", "id">);
+    REQUIRE_FALSE(CanRename<Record&, "id", "qty">);
+    REQUIRE_FALSE(CanSelect<Record, "id">);
+    REQUIRE_FALSE(CanDrop<Record, "id">);
+    REQUIRE_FALSE(CanRename<Record, "id", "key">);
+  }
+}
+
+TEST_CASE("Rvalue Getters Move") {
+  using Record = mguid::NamedTuple<mguid::NamedType<"name", std::string>>;
+  REQUIRE(std::is_same_v<decltype(std::declval<Record>().get<"name">()), std::string&&>);
+  REQUIRE(std::is_same_v<decltype(std::declval<Record>().get<0>()), std::string&&>);
+  REQUIRE(std::is_same_v<decltype(mguid::get<"name">(std::declval<Record>())), std::string&&>);
+  REQUIRE(std::is_same_v<decltype(std::declval<const Record>().get<"name">()),
+                         const std::string&&>);
+
+  Record record{std::string{"moved"}};
+  const std::string moved = std::move(record).get<"name">();
+  REQUIRE(moved == "moved");
+}
+
+template <typename... Tuples>
+concept CanConcat =
+    requires(Tuples&&... tuples) { mguid::concat(std::forward<Tuples>(tuples)...); };
+
+TEST_CASE("Concatenation") {
+  using Left =
+      mguid::NamedTuple<mguid::NamedType<"id", int>, mguid::NamedType<"name", std::string>>;
+  using Right =
+      mguid::NamedTuple<mguid::NamedType<"price", double>, mguid::NamedType<"venue", std::string>>;
+
+  SECTION("Concat Keeps Tags In Order") {
+    const Left left{1, std::string{"widget"}};
+    const Right right{2.5, std::string{"XNAS"}};
+    const auto joined = mguid::concat(left, right);
+    REQUIRE(std::is_same_v<
+            std::remove_cvref_t<decltype(joined)>,
+            mguid::NamedTuple<mguid::NamedType<"id", int>, mguid::NamedType<"name", std::string>,
+                              mguid::NamedType<"price", double>,
+                              mguid::NamedType<"venue", std::string>>>);
+    REQUIRE(joined.get<"id">() == 1);
+    REQUIRE(joined.get<"name">() == "widget");
+    REQUIRE(joined.get<"price">() == 2.5);
+    REQUIRE(joined.get<"venue">() == "XNAS");
+  }
+  SECTION("Concat Many") {
+    const auto joined = mguid::concat(mguid::NamedTuple<mguid::NamedType<"a", int>>{1},
+                                      mguid::NamedTuple<>{},
+                                      mguid::NamedTuple<mguid::NamedType<"b", int>>{2},
+                                      mguid::NamedTuple<mguid::NamedType<"c", int>>{3});
+    REQUIRE(std::tuple_size_v<std::remove_cvref_t<decltype(joined)>> == 3);
+    REQUIRE(joined.get<"c">() == 3);
+    REQUIRE(std::tuple_size_v<decltype(mguid::concat())> == 0);
+  }
+  SECTION("Concat Moves Rvalues") {
+    using Counted = mguid::NamedTuple<mguid::NamedType<"left", CopyCounter>>;
+    using OtherCounted = mguid::NamedTuple<mguid::NamedType<"right", CopyCounter>>;
+    Counted left{CopyCounter{1, 1}};
+    const OtherCounted right{CopyCounter{2, 2}};
+    CopyCounter::reset();
+    const auto joined = mguid::concat(std::move(left), right);
+    REQUIRE(CopyCounter::moves == 1);
+    REQUIRE(CopyCounter::copies == 1);
+    REQUIRE(joined.get<"right">().a == 2);
+  }
+  SECTION("Merge With Override") {
+    using Update = mguid::NamedTuple<mguid::NamedType<"name", std::string_view>,
+                                     mguid::NamedType<"qty", int>>;
+    const auto merged =
+        mguid::merge_with_override(Left{1, std::string{"widget"}}, Update{"gadget", 5});
+    REQUIRE(std::is_same_v<std::remove_cvref_t<decltype(merged)>,
+                           mguid::NamedTuple<mguid::NamedType<"id", int>,
+                                             mguid::NamedType<"name", std::string_view>,
+                                             mguid::NamedType<"qty", int>>>);
+    REQUIRE(merged.get<"id">() == 1);
+    REQUIRE(merged.get<"name">() == "gadget");
+    REQUIRE(merged.get<"qty">() == 5);
+  }
+  SECTION("Merge Without Overlap Is Concat") {
+    const auto merged = mguid::merge_with_override(Left{1, std::string{"a"}}, Right{2.0, "b"});
+    REQUIRE(merged == mguid::concat(Left{1, std::string{"a"}}, Right{2.0, "b"}));
+  }
+  SECTION("Duplicate Tags Are Rejected") {
+    REQUIRE(CanConcat<const Left&, const Right&>);
+    REQUIRE_FALSE(CanConcat<const Left&, const Left&>);
+  }
+}
+
+TEST_CASE("Allocator Aware Construction") {
+  using Record = mguid::NamedTuple<mguid::NamedType<"id", int>,
+                                   mguid::NamedType<"name", std::pmr::string>,
+                                   mguid::NamedType<"tags", std::pmr::vector<int>>>;
+  std::array<std::byte, 4096> buffer{};
+  std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(),
+                                            std::pmr::null_memory_resource()};
+  const std::pmr::polymorphic_allocator<> alloc{&arena};
+  const std::pmr::string long_name(64, 'n');
+
+  SECTION("Uses Allocator") {
+    REQUIRE(std::uses_allocator_v<Record, std::pmr::polymorphic_allocator<>>);
+  }
+  SECTION("Default With Allocator") {
+    const Record record{std::allocator_arg, alloc};
+    REQUIRE(record.get<"name">().get_allocator().resource() == &arena);
+    REQUIRE(record.get<"tags">().get_allocator().resource() == &arena);
+    REQUIRE(record.get<"id">() == 0);
+  }
+  SECTION("Values With Allocator") {
+    const Record record{std::allocator_arg, alloc, 1, long_name, std::pmr::vector<int>{1, 2, 3}};
+    REQUIRE(record.get<"name">().get_allocator().resource() == &arena);
+    REQUIRE(record.get<"name">() == long_name);
+    REQUIRE(record.get<"tags">().get_allocator().resource() == &arena);
+    REQUIRE(record.get<"tags">().size() == 3);
+  }
+  SECTION("Copy And Move With Allocator") {
+    const Record source{1, std::pmr::string{long_name}, std::pmr::vector<int>{1}};
+    REQUIRE(source.get<"name">().get_allocator().resource() != &arena);
+    const Record copy{std::allocator_arg, alloc, source};
+    REQUIRE(copy.get<"name">().get_allocator().resource() == &arena);
+    REQUIRE(copy == source);
+    Record moved{std::allocator_arg, alloc, Record{source}};
+    REQUIRE(moved.get<"name">().get_allocator().resource() == &arena);
+    REQUIRE(moved == source);
+  }
+  SECTION("Propagated By Pmr Containers") {
+    std::pmr::vector<Record> records{alloc};
+    records.emplace_back(2, long_name, std::pmr::vector<int>{4, 5});
+    records.emplace_back();
+    REQUIRE(records[0].get<"name">().get_allocator().resource() == &arena);
+    REQUIRE(records[0].get<"tags">().get_allocator().resource() == &arena);
+    REQUIRE(records[1].get<"name">().get_allocator().resource() == &arena);
+    REQUIRE(records[0].get<"name">() == long_name);
+  }
+  SECTION("Named Values With Allocator") {
+    const Record record{std::allocator_arg, alloc, mguid::NamedTypeV<"name">(long_name),
+                        mguid::NamedTypeV<"id">(3)};
+    REQUIRE(record.get<"id">() == 3);
+    REQUIRE(record.get<"name">() == long_name);
+    REQUIRE(record.get<"name">().get_allocator().resource() == &arena);
+    REQUIRE(record.get<"tags">().get_allocator().resource() == &arena);
+    const Record emplaced{std::allocator_arg, alloc,
+                          mguid::NamedTypeEmplace<"tags", std::pmr::vector<int>>(std::size_t{4})};
+    REQUIRE(emplaced.get<"tags">().size() == 4);
+    REQUIRE(emplaced.get<"tags">().get_allocator().resource() == &arena);
+  }
+  SECTION("Named Values Propagated By Pmr Containers") {
+    std::pmr::vector<Record> records{alloc};
+    records.reserve(2);
+    records.emplace_back(1, long_name, std::pmr::vector<int>{1});
+    records.emplace_back(mguid::NamedTypeV<"name">(long_name), mguid::NamedTypeV<"id">(2));
+    REQUIRE(records[1].get<"id">() == 2);
+    REQUIRE(records[1].get<"name">() == long_name);
+    REQUIRE(records[1].get<"name">().get_allocator().resource() == &arena);
+    REQUIRE(records[1].get<"tags">().get_allocator().resource() == &arena);
+  }
+  SECTION("Only Matching Values With Allocator") {
+    REQUIRE_FALSE(std::is_constructible_v<Record, std::allocator_arg_t,
+                                          std::pmr::polymorphic_allocator<>, int, int, int>);
+    REQUIRE_FALSE(std::is_constructible_v<Record, std::allocator_arg_t,
+                                          std::pmr::polymorphic_allocator<>,
+                                          decltype(mguid::NamedTypeV<"missing">(1))>);
+  }
+}
+
+TEST_CASE("Tag Based Visitation") {
+  using Order = mguid::NamedTuple<mguid::NamedType<"id", int>, mguid::NamedType<"price", double>,
+                                  mguid::NamedType<"venue", std::string>>;
+
+  SECTION("For Each Visits In Declared Order") {
+    const Order order{7, 2.5, std::string{"XNAS"}};
+    std::string names{};
+    mguid::for_each(order, [&names](auto named_type, const auto&) {
+      names += named_type.name();
+      names += ';';
+    });
+    REQUIRE(names == "id;price;venue;");
+  }
+  SECTION("For Each Mutates Through References") {
+    Order order{7, 2.5, std::string{"XNAS"}};
+    mguid::for_each(order, [](auto named_type, auto& value) {
+      if constexpr (std::is_same_v<std::remove_cvref_t<decltype(value)>, std::string>) {
+        if (named_type == std::string_view{"venue"}) { value += "!"; }
+      } else {
+        value *= 2;
+      }
+    });
+    REQUIRE(order == Order{14, 5.0, std::string{"XNAS!"}});
+  }
+  SECTION("For Each Is Constexpr") {
+    constexpr auto total = [] {
+      mguid::NamedTuple<mguid::NamedType<"a", int>, mguid::NamedType<"b", int>> nt{3, 4};
+      int sum{};
+      mguid::for_each(nt, [&sum](auto, int value) { sum += value; });
+      return sum;
+    }();
+    STATIC_REQUIRE(total == 7);
+  }
+  SECTION("Apply Named Passes Tagged Values") {
+    const Order order{7, 2.5, std::string{"XNAS"}};
+    const auto description = mguid::apply_named(
+        [](const auto&... fields) {
+          std::string result{};
+          ((result += std::string{fields.name()} + "=" + [](const auto& value) {
+              if constexpr (std::is_same_v<std::remove_cvref_t<decltype(value)>, std::string>) {
+                return value;
+              } else {
+                return std::to_string(static_cast<int>(value));
+              }
+            }(fields.value) + ";"),
+           ...);
+          return result;
+        },
+        order);
+    REQUIRE(description == "id=7;price=2;venue=XNAS;");
+  }
+  SECTION("Apply Named Feeds Named Construction") {
+    using Reordered = mguid::NamedTuple<mguid::NamedType<"venue", std::string>,
+                                        mguid::NamedType<"id", int>,
+                                        mguid::NamedType<"price", double>>;
+    Order order{7, 2.5, std::string{"XNAS"}};
+    const auto reordered =
+        mguid::apply_named([](auto&&... fields) { return Reordered{std::move(fields)...}; },
+                           std::move(order));
+    REQUIRE(reordered.get<"venue">() == "XNAS");
+    REQUIRE(reordered.get<"id">() == 7);
+    REQUIRE(reordered.get<"price">() == 2.5);
+  }
+  SECTION("Transform Maps Types And Keeps Tags") {
+    const mguid::NamedTuple<mguid::NamedType<"a", int>, mguid::NamedType<"b", double>> nt{2, 1.5};
+    const auto mapped = mguid::transform(nt, [](auto value) { return std::to_string(value * 2); });
+    REQUIRE(std::is_same_v<std::remove_cvref_t<decltype(mapped)>,
+                           mguid::NamedTuple<mguid::NamedType<"a", std::string>,
+                                             mguid::NamedType<"b", std::string>>>);
+    REQUIRE(mapped.get<"a">() == "4");
+    REQUIRE(mapped.get<"b">().starts_with("3"));
+  }
+  SECTION("Transform Is Constexpr") {
+    constexpr mguid::NamedTuple<mguid::NamedType<"a", int>, mguid::NamedType<"b", char>> nt{2, 'x'};
+    constexpr auto sizes = mguid::transform(nt, [](auto value) { return sizeof(value); });
+    STATIC_REQUIRE(sizes.get<"a">() == sizeof(int));
+    STATIC_REQUIRE(sizes.get<"b">() == sizeof(char));
+  }
+}
+
+namespace {
+// no padding, but equality ignores the version
+struct VersionedKey {
+  std::uint32_t id;
+  std::uint32_t version;
+
+  [[nodiscard]] constexpr bool operator==(const VersionedKey& other) const {
+    return id == other.id;
+  }
+};
+}  // namespace
+
+TEST_CASE("Specialized Comparison") {
+  using Key = mguid::NamedTuple<mguid::NamedType<"hi", std::uint16_t>,
+                                mguid::NamedType<"mid", std::uint8_t>,
+                                mguid::NamedType<"lo", std::uint32_t>>;
+  using Bytes = mguid::NamedTuple<mguid::NamedType<"id", std::array<std::byte, 3>>,
+                                  mguid::NamedType<"flag", std::uint8_t>>;
+  using Mixed = mguid::NamedTuple<mguid::NamedType<"ts", std::int64_t>,
+                                  mguid::NamedType<"px", double>,
+                                  mguid::NamedType<"id", std::uint32_t>>;
+  constexpr auto generic = [](const auto& lhs, const auto& rhs) {
+    return std::tie(lhs.template get<0>(), lhs.template get<1>(), lhs.template get<2>()) <=>
+           std::tie(rhs.template get<0>(), rhs.template get<1>(), rhs.template get<2>());
+  };
+
+  SECTION("Traits") {
+    STATIC_REQUIRE(mguid::packed_comparable_v<std::uint16_t, std::uint8_t, std::uint32_t>);
+    STATIC_REQUIRE_FALSE(mguid::packed_comparable_v<std::uint64_t>);
+    STATIC_REQUIRE_FALSE(mguid::packed_comparable_v<std::uint32_t, std::uint64_t>);
+    STATIC_REQUIRE_FALSE(mguid::packed_comparable_v<std::uint32_t, std::int32_t>);
+    STATIC_REQUIRE(mguid::is_byte_array_v<std::array<std::byte, 3>>);
+    STATIC_REQUIRE_FALSE(mguid::is_byte_array_v<std::array<char, 3>>);
+    STATIC_REQUIRE(mguid::byte_comparable_v<Bytes, std::array<std::byte, 3>, std::uint8_t>);
+    STATIC_REQUIRE_FALSE(mguid::byte_comparable_v<Mixed, std::int64_t, double, std::uint32_t>);
+    STATIC_REQUIRE(mguid::bytewise_equality_v<std::array<std::byte, 3>>);
+    STATIC_REQUIRE_FALSE(mguid::bytewise_equality_v<VersionedKey>);
+    STATIC_REQUIRE_FALSE(mguid::bytewise_equality_v<std::array<VersionedKey, 2>>);
+    STATIC_REQUIRE(mguid::pack_unsigned(std::uint8_t{1}, std::uint16_t{2}) == 0x10002);
+  }
+  SECTION("Custom Equality Of Padding Free Elements") {
+    using Versioned = mguid::NamedTuple<mguid::NamedType<"k", VersionedKey>>;
+    REQUIRE(Versioned{VersionedKey{1, 1}} == Versioned{VersionedKey{1, 2}});
+    REQUIRE_FALSE(Versioned{VersionedKey{1, 1}} == Versioned{VersionedKey{2, 1}});
+  }
+  SECTION("Packed Ordering Matches Generic Ordering") {
+    const std::array<std::uint32_t, 5> values{0, 1, 255, 65'535, 4'294'967'295U};
+    for (const auto a : values) {
+      for (const auto b : values) {
+        const Key lhs{static_cast<std::uint16_t>(a), static_cast<std::uint8_t>(b), b};
+        const Key rhs{static_cast<std::uint16_t>(b), static_cast<std::uint8_t>(a), a};
+        REQUIRE((lhs <=> rhs) == generic(lhs, rhs));
+        REQUIRE((lhs <=> lhs) == std::strong_ordering::equal);
+        REQUIRE((lhs == rhs) == (generic(lhs, rhs) == 0));
+      }
+    }
+  }
+  SECTION("Byte Arrays Order Like Their Bytes") {
+    const Bytes lhs{std::array{std::byte{1}, std::byte{2}, std::byte{0xFF}}, std::uint8_t{0}};
+    const Bytes rhs{std::array{std::byte{1}, std::byte{3}, std::byte{0}}, std::uint8_t{0}};
+    REQUIRE((lhs <=> rhs) == std::strong_ordering::less);
+    REQUIRE((rhs <=> lhs) == std::strong_ordering::greater);
+    REQUIRE(lhs == Bytes{lhs});
+    REQUIRE(lhs != rhs);
+  }
+  SECTION("Mixed Elements Use The Generic Ordering") {
+    const Mixed lhs{1, 2.5, 3U};
+    const Mixed rhs{1, 2.5, 4U};
+    REQUIRE((lhs <=> rhs) == generic(lhs, rhs));
+    REQUIRE((lhs <=> rhs) == std::partial_ordering::less);
+  }
+  SECTION("Compare By Custom Order") {
+    const Mixed lhs{1, 2.5, 9U};
+    const Mixed rhs{2, 2.5, 3U};
+    REQUIRE(mguid::compare_by<"ts">(lhs, rhs) == std::strong_ordering::less);
+    REQUIRE(mguid::compare_by<"id", "ts">(lhs, rhs) == std::strong_ordering::greater);
+    REQUIRE(mguid::compare_by<"px", "id">(lhs, rhs) == std::partial_ordering::greater);
+    REQUIRE(mguid::CompareBy<"px">{}(lhs, rhs) == std::partial_ordering::equivalent);
+    const Key key{1, 2, 3};
+    REQUIRE(mguid::compare_by<"lo", "hi">(key, Key{1, 2, 4}) == std::strong_ordering::less);
+  }
+  SECTION("Constant Evaluation") {
+    constexpr Key lhs{1, 2, 3};
+    constexpr Key rhs{1, 2, 4};
+    STATIC_REQUIRE((lhs <=> rhs) == std::strong_ordering::less);
+    STATIC_REQUIRE(lhs != rhs);
+    constexpr Bytes bytes{std::array{std::byte{1}, std::byte{2}, std::byte{3}}, std::uint8_t{0}};
+    STATIC_REQUIRE(bytes == bytes);
+    STATIC_REQUIRE((bytes <=> bytes) == std::strong_ordering::equal);
+  }
+}
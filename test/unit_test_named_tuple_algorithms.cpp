@@ -0,0 +1,144 @@
+#include "NamedTupleAlgorithms.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using Trade = mguid::NamedTuple<mguid::NamedType<"ts", std::int64_t>, mguid::NamedType<"id", int>,
+                                mguid::NamedType<"price", double>, mguid::NamedType<"qty", int>>;
+using TradeColumns =
+    mguid::NamedTupleColumns<mguid::NamedType<"ts", std::int64_t>, mguid::NamedType<"id", int>,
+                             mguid::NamedType<"price", double>, mguid::NamedType<"qty", int>>;
+
+namespace {
+std::vector<Trade> make_trades() {
+  return {Trade{30, 2, 1.5, 10}, Trade{10, 1, 3.0, -5}, Trade{20, 3, 0.5, 7},
+          Trade{10, 0, 2.0, 1},  Trade{40, 4, 4.0, 3},  Trade{20, 1, 1.0, 2}};
+}
+
+TradeColumns make_trade_columns() {
+  TradeColumns columns;
+  for (const auto& trade : make_trades()) { columns.push_back(trade); }
+  return columns;
+}
+}  // namespace
+
+TEST_CASE("Sum By Tag") {
+  SECTION("Range") {
+    const auto trades = make_trades();
+    REQUIRE(mguid::sum<"qty">(trades) == 18);
+    REQUIRE(mguid::sum<"price">(trades) == 12.0);
+  }
+  SECTION("Columns") {
+    const auto columns = make_trade_columns();
+    REQUIRE(mguid::sum<"qty">(columns) == 18);
+    REQUIRE(mguid::sum<"price">(columns) == 12.0);
+  }
+  SECTION("Empty") {
+    REQUIRE(mguid::sum<"qty">(std::vector<Trade>{}) == 0);
+    REQUIRE(mguid::sum<"qty">(TradeColumns{}) == 0);
+  }
+  SECTION("Longer Than The Unrolled Loop") {
+    TradeColumns columns;
+    for (int i{0}; i < 37; ++i) { columns.emplace_back(i, i, 0.5, i); }
+    REQUIRE(mguid::sum<"qty">(columns) == 666);
+    REQUIRE(mguid::sum<"price">(columns) == 18.5);
+  }
+  SECTION("Widens") {
+    using Narrow = mguid::NamedTuple<mguid::NamedType<"q", std::int32_t>,
+                                     mguid::NamedType<"lots", std::uint8_t>,
+                                     mguid::NamedType<"size", float>>;
+    const std::vector<Narrow> rows{Narrow{2'000'000'000, std::uint8_t{200}, 0.5F},
+                                   Narrow{2'000'000'000, std::uint8_t{200}, 0.5F},
+                                   Narrow{2'000'000'000, std::uint8_t{200}, 0.5F}};
+    mguid::NamedTupleColumns<mguid::NamedType<"q", std::int32_t>,
+                             mguid::NamedType<"lots", std::uint8_t>,
+                             mguid::NamedType<"size", float>>
+        columns;
+    for (int copy{0}; copy < 3; ++copy) {
+      for (const auto& row : rows) { columns.push_back(row); }
+    }
+    STATIC_REQUIRE(std::is_same_v<decltype(mguid::sum<"q">(rows)), std::int64_t>);
+    STATIC_REQUIRE(std::is_same_v<decltype(mguid::sum<"lots">(columns)), std::uint64_t>);
+    STATIC_REQUIRE(std::is_same_v<decltype(mguid::sum<"size">(columns)), double>);
+    REQUIRE(mguid::sum<"q">(rows) == 6'000'000'000);
+    REQUIRE(mguid::sum<"lots">(rows) == 600);
+    REQUIRE(mguid::sum<"q">(columns) == 18'000'000'000);
+    REQUIRE(mguid::sum<"lots">(columns) == 1'800);
+    REQUIRE(mguid::sum<"size">(columns) == 4.5);
+  }
+}
+
+TEST_CASE("Min Max By Tag") {
+  SECTION("Range") {
+    const auto result = mguid::min_max<"qty">(make_trades());
+    REQUIRE(result.has_value());
+    REQUIRE(result->min == -5);
+    REQUIRE(result->max == 10);
+  }
+  SECTION("Columns") {
+    const auto result = mguid::min_max<"price">(make_trade_columns());
+    REQUIRE(result.has_value());
+    REQUIRE(result->min == 0.5);
+    REQUIRE(result->max == 4.0);
+  }
+  SECTION("Empty") {
+    REQUIRE_FALSE(mguid::min_max<"qty">(std::vector<Trade>{}).has_value());
+    REQUIRE_FALSE(mguid::min_max<"qty">(TradeColumns{}).has_value());
+  }
+}
+
+TEST_CASE("Filter By Tag") {
+  SECTION("Range") {
+    const auto result = mguid::filter<"qty">(make_trades(), [](int qty) { return qty > 2; });
+    REQUIRE(result.size() == 3);
+    REQUIRE(result[0].get<"ts">() == 30);
+    REQUIRE(result[1].get<"ts">() == 20);
+    REQUIRE(result[2].get<"ts">() == 40);
+  }
+  SECTION("Columns") {
+    const auto result =
+        mguid::filter<"qty">(make_trade_columns(), [](int qty) { return qty > 2; });
+    REQUIRE(result.size() == 3);
+    REQUIRE(result[0].to_tuple() == Trade{30, 2, 1.5, 10});
+    REQUIRE(result[1].to_tuple() == Trade{20, 3, 0.5, 7});
+    REQUIRE(result[2].to_tuple() == Trade{40, 4, 4.0, 3});
+  }
+  SECTION("Nothing Selected") {
+    REQUIRE(mguid::filter<"qty">(make_trade_columns(), [](int) { return false; }).empty());
+  }
+}
+
+TEST_CASE("Sort By Tags") {
+  const std::vector<Trade> expected{Trade{10, 0, 2.0, 1}, Trade{10, 1, 3.0, -5},
+                                    Trade{20, 1, 1.0, 2}, Trade{20, 3, 0.5, 7},
+                                    Trade{30, 2, 1.5, 10}, Trade{40, 4, 4.0, 3}};
+
+  SECTION("Range") {
+    auto trades = make_trades();
+    mguid::sort_by<"ts", "id">(trades);
+    REQUIRE(trades == expected);
+  }
+  SECTION("Columns") {
+    auto columns = make_trade_columns();
+    mguid::sort_by<"ts", "id">(columns);
+    REQUIRE(columns.size() == expected.size());
+    for (std::size_t i{0}; i < expected.size(); ++i) {
+      REQUIRE(columns[i].to_tuple() == expected[i]);
+    }
+  }
+  SECTION("Single Tag") {
+    auto trades = make_trades();
+    mguid::sort_by<"price">(trades);
+    REQUIRE(trades.front().get<"price">() == 0.5);
+    REQUIRE(trades.back().get<"price">() == 4.0);
+  }
+  SECTION("Less By") {
+    REQUIRE(mguid::less_by<"ts", "id">(Trade{10, 0, 0.0, 0}, Trade{10, 1, 0.0, 0}));
+    REQUIRE_FALSE(mguid::less_by<"ts", "id">(Trade{10, 1, 0.0, 0}, Trade{10, 1, 0.0, 0}));
+    REQUIRE_FALSE(mguid::less_by<"ts", "id">(Trade{20, 0, 0.0, 0}, Trade{10, 1, 0.0, 0}));
+  }
+}
@@ -0,0 +1,115 @@
+#include "NamedTupleColumnFile.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+using Tick = mguid::NamedTuple<mguid::NamedType<"ts", std::int64_t>,
+                               mguid::NamedType<"price", double>,
+                               mguid::NamedType<"side", char>,
+                               mguid::NamedType<"qty", std::int32_t>>;
+using Ticks = mguid::NamedTupleColumns<mguid::NamedType<"ts", std::int64_t>,
+                                       mguid::NamedType<"price", double>,
+                                       mguid::NamedType<"side", char>,
+                                       mguid::NamedType<"qty", std::int32_t>>;
+using Retyped = mguid::NamedTuple<mguid::NamedType<"ts", std::int64_t>,
+                                  mguid::NamedType<"price", float>,
+                                  mguid::NamedType<"side", char>,
+                                  mguid::NamedType<"qty", std::int32_t>>;
+
+class TemporaryFile {
+public:
+  explicit TemporaryFile(const std::string& name)
+      : m_path{std::filesystem::temp_directory_path() / name} {}
+  TemporaryFile(const TemporaryFile&) = delete;
+  TemporaryFile& operator=(const TemporaryFile&) = delete;
+  ~TemporaryFile() {
+    std::error_code error{};
+    std::filesystem::remove(m_path, error);
+  }
+
+  [[nodiscard]] const std::filesystem::path& path() const noexcept { return m_path; }
+
+private:
+  std::filesystem::path m_path;
+};
+
+Ticks make_ticks(std::size_t count) {
+  Ticks ticks{};
+  for (std::size_t index{0}; index < count; ++index) {
+    ticks.emplace_back(static_cast<std::int64_t>(1'000 + index), 100.0 + static_cast<double>(index),
+                       index % 2 == 0 ? 'B' : 'S', static_cast<std::int32_t>(index * 10));
+  }
+  return ticks;
+}
+}  // namespace
+
+TEST_CASE("Column File Round Trip") {
+  const TemporaryFile file{"named_tuple_column_file_round_trip.bin"};
+  const Ticks ticks = make_ticks(5000);
+  REQUIRE(mguid::write_column_file(ticks, file.path()));
+
+  auto mapped = mguid::MappedColumnFile<Tick>::open(file.path());
+  REQUIRE(mapped.has_value());
+  REQUIRE(mapped->size() == ticks.size());
+
+  SECTION("Columns Are Viewed In Place") {
+    const auto prices = mapped->column<"price">();
+    REQUIRE(prices.size() == ticks.size());
+    REQUIRE(reinterpret_cast<std::uintptr_t>(prices.data()) % mguid::kColumnFilePageSize == 0);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(mapped->column<"side">().data()) %
+                mguid::kColumnFilePageSize ==
+            0);
+    REQUIRE(std::equal(prices.begin(), prices.end(), ticks.column<"price">().begin()));
+    REQUIRE(std::equal(mapped->column<"qty">().begin(), mapped->column<"qty">().end(),
+                       ticks.column<"qty">().begin()));
+    mapped->will_need<"ts">();
+    REQUIRE(mapped->column<"ts">().back() == 1'000 + 4'999);
+  }
+  SECTION("Rows") {
+    REQUIRE(mapped->row(0) == Tick{1'000, 100.0, 'B', 0});
+    REQUIRE(mapped->row(4'999) == static_cast<Tick>(ticks[4'999]));
+  }
+  SECTION("Columns Start On Page Boundaries In The File") {
+    REQUIRE(std::filesystem::file_size(file.path()) % mguid::kColumnFilePageSize == 0);
+  }
+  SECTION("Mapping Can Be Moved") {
+    auto moved = std::move(*mapped);
+    REQUIRE(moved.column<"price">()[10] == 110.0);
+  }
+}
+
+TEST_CASE("Column File Validation") {
+  const TemporaryFile file{"named_tuple_column_file_validation.bin"};
+
+  SECTION("Empty Dataset") {
+    REQUIRE(mguid::write_column_file(Ticks{}, file.path()));
+    const auto mapped = mguid::MappedColumnFile<Tick>::open(file.path());
+    REQUIRE(mapped.has_value());
+    REQUIRE(mapped->empty());
+    REQUIRE(mapped->column<"price">().empty());
+  }
+  SECTION("Different Schema Is Rejected") {
+    REQUIRE(mguid::write_column_file(make_ticks(10), file.path()));
+    REQUIRE_FALSE(mguid::MappedColumnFile<Retyped>::open(file.path()).has_value());
+  }
+  SECTION("Truncated File Is Rejected") {
+    REQUIRE(mguid::write_column_file(make_ticks(10), file.path()));
+    std::filesystem::resize_file(file.path(), 2 * mguid::kColumnFilePageSize);
+    REQUIRE_FALSE(mguid::MappedColumnFile<Tick>::open(file.path()).has_value());
+  }
+  SECTION("Foreign File Is Rejected") {
+    std::ofstream{file.path()} << std::string(mguid::kColumnFilePageSize, 'x');
+    REQUIRE_FALSE(mguid::MappedColumnFile<Tick>::open(file.path()).has_value());
+  }
+  SECTION("Missing File") {
+    REQUIRE_FALSE(mguid::MappedColumnFile<Tick>::open(file.path() / "missing").has_value());
+  }
+}
@@ -0,0 +1,124 @@
+#include "NamedTupleColumns.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+using Columns = mguid::NamedTupleColumns<mguid::NamedType<"ts", std::int64_t>,
+                                         mguid::NamedType<"price", double>,
+                                         mguid::NamedType<"symbol", std::string>>;
+using Row = Columns::RowType;
+
+TEST_CASE("NamedTupleColumns Construction") {
+  SECTION("Empty") {
+    Columns cols;
+    REQUIRE(cols.empty());
+    REQUIRE(cols.size() == 0);
+    REQUIRE(Columns::column_count() == 3);
+  }
+  SECTION("Reserve") {
+    Columns cols;
+    cols.reserve(128);
+    REQUIRE(cols.capacity() >= 128);
+    REQUIRE(cols.empty());
+  }
+  SECTION("Resize") {
+    Columns cols;
+    cols.resize(4);
+    REQUIRE(cols.size() == 4);
+    REQUIRE(cols.column<"price">()[3] == 0.0);
+    REQUIRE(cols.column<"symbol">()[3].empty());
+  }
+}
+
+TEST_CASE("NamedTupleColumns Insertion") {
+  Columns cols;
+  cols.push_back(Row{1, 1.5, "abc"});
+  const Row moved_from{2, 2.5, "def"};
+  cols.push_back(Row{moved_from});
+  auto row = cols.emplace_back(std::int64_t{3}, 3.5, "ghi");
+
+  REQUIRE(cols.size() == 3);
+  REQUIRE(row.index() == 2);
+  REQUIRE(row.get<"symbol">() == "ghi");
+
+  SECTION("Pop Back") {
+    cols.pop_back();
+    REQUIRE(cols.size() == 2);
+    REQUIRE(cols[1].get<"ts">() == 2);
+  }
+  SECTION("Clear") {
+    cols.clear();
+    REQUIRE(cols.empty());
+  }
+}
+
+TEST_CASE("NamedTupleColumns Column Access") {
+  Columns cols;
+  for (std::int64_t i{0}; i < 100; ++i) {
+    cols.emplace_back(i, static_cast<double>(i) * 0.5, std::to_string(i));
+  }
+
+  SECTION("Span Types") {
+    REQUIRE(std::is_same_v<decltype(cols.column<"price">()), std::span<double>>);
+    REQUIRE(std::is_same_v<decltype(std::as_const(cols).column<"price">()),
+                           std::span<const double>>);
+    REQUIRE(std::is_same_v<decltype(cols.column<0>()), std::span<std::int64_t>>);
+  }
+  SECTION("Alignment") {
+    REQUIRE(reinterpret_cast<std::uintptr_t>(cols.column<"ts">().data()) % mguid::kCacheLineSize ==
+            0);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(cols.column<"price">().data()) %
+                mguid::kCacheLineSize ==
+            0);
+  }
+  SECTION("Scan") {
+    const auto prices = cols.column<"price">();
+    REQUIRE(prices.size() == 100);
+    REQUIRE(std::accumulate(prices.begin(), prices.end(), 0.0) == 2475.0);
+  }
+  SECTION("Write Through Span") {
+    cols.column<"ts">()[10] = -1;
+    REQUIRE(cols[10].get<"ts">() == -1);
+  }
+}
+
+TEST_CASE("NamedTupleColumns Row Proxy") {
+  Columns cols;
+  cols.push_back(Row{7, 1.25, "xyz"});
+
+  SECTION("Get") {
+    auto row = cols[0];
+    REQUIRE(row.get<"ts">() == 7);
+    REQUIRE(row.get<"price">() == 1.25);
+    REQUIRE(row.get<2>() == "xyz");
+  }
+  SECTION("Set") {
+    cols[0].set<"price">(9.0);
+    cols[0].get<"symbol">() = "abc";
+    REQUIRE(cols.column<"price">()[0] == 9.0);
+    REQUIRE(cols.column<"symbol">()[0] == "abc");
+  }
+  SECTION("Const Row") {
+    const auto& const_cols = cols;
+    REQUIRE(std::is_same_v<decltype(const_cols[0].get<"ts">()), const std::int64_t&>);
+  }
+  SECTION("Conversion To NamedTuple") {
+    const Row row = cols[0];
+    REQUIRE(row == Row{7, 1.25, "xyz"});
+    REQUIRE(cols[0].to_tuple() == row);
+  }
+  SECTION("Assign From NamedTuple") {
+    cols[0] = Row{8, 2.0, "new"};
+    REQUIRE(cols[0].get<"ts">() == 8);
+    REQUIRE(cols[0].get<"symbol">() == "new");
+  }
+  SECTION("Bounds Checked Access") {
+    REQUIRE_NOTHROW(cols.at(0));
+    REQUIRE_THROWS_AS(cols.at(1), std::out_of_range);
+  }
+}
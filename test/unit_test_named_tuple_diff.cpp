@@ -0,0 +1,122 @@
+#include "NamedTupleDiff.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+using Record = mguid::NamedTuple<mguid::NamedType<"id", std::uint64_t>,
+                                 mguid::NamedType<"price", double>,
+                                 mguid::NamedType<"qty", std::int32_t>,
+                                 mguid::NamedType<"side", char>>;
+using Mask = mguid::FieldMaskFor<Record>;
+
+namespace {
+// trivially copyable without a default constructor
+struct Price {
+  explicit constexpr Price(std::int64_t init_ticks) : ticks{init_ticks} {}
+  [[nodiscard]] constexpr bool operator==(const Price&) const = default;
+  std::int64_t ticks;
+};
+}  // namespace
+
+TEST_CASE("FieldMask") {
+  STATIC_REQUIRE(std::is_same_v<Mask::Word, std::uint8_t>);
+  STATIC_REQUIRE(Mask::size() == 4);
+
+  Mask mask;
+  REQUIRE(mask.none());
+  mask.set(1).set(3);
+  REQUIRE(mask.any());
+  REQUIRE(mask.test(1));
+  REQUIRE(!mask.test(2));
+  REQUIRE(mask.count() == 2);
+  mask.reset(1);
+  REQUIRE(mask.count() == 1);
+  REQUIRE((mask | Mask{}.set(0)).words()[0] == 0b1001);
+
+  // bits past the last element are dropped
+  REQUIRE(Mask{Mask::Words{0xFF}}.count() == 4);
+
+  using Wide = mguid::FieldMask<70>;
+  STATIC_REQUIRE(Wide::kWordCount == 2);
+  Wide wide;
+  wide.set(69).set(0);
+  REQUIRE(wide.test(69));
+  REQUIRE(wide.count() == 2);
+}
+
+TEST_CASE("Diff") {
+  const Record from{1U, 10.5, 3, 'b'};
+
+  SECTION("Equal") { REQUIRE(mguid::diff(from, from).none()); }
+  SECTION("Changed Fields") {
+    Record to{from};
+    to.set<"price">(11.0);
+    to.set<"side">('s');
+    const auto mask = mguid::diff(from, to);
+    REQUIRE(mask.count() == 2);
+    REQUIRE(mask.test(1));
+    REQUIRE(mask.test(3));
+  }
+  SECTION("Non Trivial Elements") {
+    using Named = mguid::NamedTuple<mguid::NamedType<"name", std::string>,
+                                    mguid::NamedType<"count", int>>;
+    const auto mask = mguid::diff(Named{"a", 1}, Named{"b", 1});
+    REQUIRE(mask.words()[0] == 0b01);
+
+    Named target{"a", 1};
+    mguid::apply_patch(target, mask, Named{"b", 7});
+    REQUIRE(target == Named{"b", 1});
+  }
+  SECTION("Constant Evaluated") {
+    STATIC_REQUIRE(mguid::diff(Record{1U, 1.0, 1, 'a'}, Record{1U, 2.0, 1, 'a'}).test(1));
+  }
+}
+
+TEST_CASE("Patch") {
+  const Record from{1U, 10.5, 3, 'b'};
+  Record to{from};
+  to.set<"qty">(4);
+  to.set<"side">('s');
+  const auto mask = mguid::diff(from, to);
+
+  REQUIRE(mguid::patch_size<Record>(mask) == 5);
+
+  std::array<std::byte, 16> payload{};
+  const auto written = mguid::serialize_patch(to, mask, std::span{payload});
+  REQUIRE(written == 5);
+  REQUIRE(written < mguid::serialized_size_v<Record>);
+
+  SECTION("Apply") {
+    Record replica{from};
+    REQUIRE(mguid::apply_patch(replica, mask, std::span<const std::byte>{payload}.first(written)));
+    REQUIRE(replica == to);
+  }
+  SECTION("Truncated Payload") {
+    Record replica{from};
+    REQUIRE(!mguid::apply_patch(replica, mask, std::span<const std::byte>{payload}.first(4)));
+    REQUIRE(replica == from);
+  }
+  SECTION("Buffer Too Small") {
+    std::array<std::byte, 4> small{};
+    REQUIRE(mguid::serialize_patch(to, mask, std::span{small}) == 0);
+  }
+  SECTION("Elements Without A Default Constructor") {
+    using Quote = mguid::NamedTuple<mguid::NamedType<"id", std::uint32_t>,
+                                    mguid::NamedType<"price", Price>>;
+    const Quote old_quote{1U, Price{100}};
+    const Quote new_quote{1U, Price{101}};
+    const auto quote_mask = mguid::diff(old_quote, new_quote);
+    std::array<std::byte, 8> quote_payload{};
+    const auto quote_written =
+        mguid::serialize_patch(new_quote, quote_mask, std::span{quote_payload});
+    Quote replica{old_quote};
+    REQUIRE(mguid::apply_patch(replica, quote_mask,
+                               std::span<const std::byte>{quote_payload}.first(quote_written)));
+    REQUIRE(replica.get<"price">().ticks == 101);
+  }
+}
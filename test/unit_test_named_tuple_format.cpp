@@ -0,0 +1,64 @@
+#include "NamedTupleFormat.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#if defined(__cpp_lib_format)
+namespace format_library = std;
+#elif defined(NAMED_TUPLE_USE_FMT)
+namespace format_library = fmt;
+#endif
+
+#if defined(__cpp_lib_format) || defined(NAMED_TUPLE_USE_FMT)
+using Quote =
+    mguid::NamedTuple<mguid::NamedType<"symbol", std::string>, mguid::NamedType<"bid", double>,
+                      mguid::NamedType<"size", std::int32_t>>;
+
+TEST_CASE("Format Field Prefix") {
+  constexpr auto first = mguid::kFormatFieldPrefix<"bid", true>;
+  constexpr auto other = mguid::kFormatFieldPrefix<"bid", false>;
+  STATIC_REQUIRE(std::string_view{first.data(), first.size()} == "{bid=");
+  STATIC_REQUIRE(std::string_view{other.data(), other.size()} == ", bid=");
+}
+
+TEST_CASE("Formatting") {
+  const Quote quote{std::string{"ABC"}, 101.256, 300};
+
+  SECTION("Default Spec") {
+    REQUIRE(format_library::format("{}", quote) == "{symbol=ABC, bid=101.256, size=300}");
+  }
+  SECTION("Per Element Spec") {
+    REQUIRE(format_library::format("{:bid=.2f}", quote) == "{symbol=ABC, bid=101.26, size=300}");
+    REQUIRE(format_library::format("{:size=>5;symbol=<4;bid=.1f}", quote) ==
+            "{symbol=ABC , bid=101.3, size=  300}");
+  }
+  SECTION("Later Spec For The Same Element Wins") {
+    REQUIRE(format_library::format("{:bid=.1f;bid=.3f}", quote) ==
+            "{symbol=ABC, bid=101.256, size=300}");
+  }
+  SECTION("Empty And Nested Tuples") {
+    REQUIRE(format_library::format("{}", mguid::NamedTuple<>{}) == "{}");
+    const mguid::NamedTuple<mguid::NamedType<"quote", Quote>, mguid::NamedType<"venue", char>>
+        nested{quote, 'X'};
+    REQUIRE(format_library::format("{}", nested) ==
+            "{quote={symbol=ABC, bid=101.256, size=300}, venue=X}");
+  }
+  SECTION("Truncated Fixed Buffer") {
+    std::array<char, 16> buffer{};
+    const auto result = format_library::format_to_n(buffer.data(), buffer.size(), "{}", quote);
+    REQUIRE(result.size == 35);
+    REQUIRE(std::string_view{buffer.data(), buffer.size()} == "{symbol=ABC, bid");
+  }
+  SECTION("Invalid Specs Are Rejected") {
+    for (const std::string_view spec : {"{:price=.2f}", "{:bid}", "{:bid=q}", "{:size=.2f}"}) {
+      INFO(spec);
+      REQUIRE_THROWS_AS(format_library::vformat(spec, format_library::make_format_args(quote)),
+                        format_library::format_error);
+    }
+  }
+}
+#endif
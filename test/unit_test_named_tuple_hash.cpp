@@ -0,0 +1,128 @@
+#include "NamedTupleHash.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+using Key = mguid::NamedTuple<mguid::NamedType<"symbol", std::string>,
+                              mguid::NamedType<"venue", std::string>,
+                              mguid::NamedType<"side", char>>;
+using Ids = mguid::NamedTuple<mguid::NamedType<"id", std::uint64_t>,
+                              mguid::NamedType<"account", std::uint32_t>,
+                              mguid::NamedType<"desk", std::uint32_t>>;
+using PackedIds =
+    mguid::PackedNamedTuple<mguid::NamedType<"side", char>, mguid::NamedType<"id", std::uint64_t>,
+                            mguid::NamedType<"account", std::uint32_t>,
+                            mguid::NamedType<"flags", std::uint16_t>,
+                            mguid::NamedType<"kind", std::uint8_t>>;
+
+namespace {
+// no padding, but equality and hash ignore the version
+struct VersionedId {
+  std::uint32_t id;
+  std::uint32_t version;
+
+  [[nodiscard]] constexpr bool operator==(const VersionedId& other) const {
+    return id == other.id;
+  }
+};
+}  // namespace
+
+// NOLINTBEGIN(cert-dcl58-cpp)
+template <>
+struct std::hash<VersionedId> {
+  [[nodiscard]] std::size_t operator()(const VersionedId& value) const noexcept {
+    return value.id;
+  }
+};
+// NOLINTEND(cert-dcl58-cpp)
+
+TEST_CASE("Std Hash") {
+  SECTION("Equal Tuples Hash Equal") {
+    const std::hash<Key> hasher{};
+    REQUIRE(hasher(Key{"AAPL", "XNAS", 'b'}) == hasher(Key{"AAPL", "XNAS", 'b'}));
+    REQUIRE(hasher(Key{"AAPL", "XNAS", 'b'}) != hasher(Key{"AAPL", "XNAS", 's'}));
+    REQUIRE(hasher(Key{"AAPL", "XNAS", 'b'}) != hasher(Key{"XNAS", "AAPL", 'b'}));
+  }
+  SECTION("Byte Hashing Without Padding") {
+    REQUIRE(mguid::byte_hashable_v<Ids, std::uint64_t, std::uint32_t, std::uint32_t>);
+    REQUIRE(mguid::byte_hashable_v<PackedIds, char, std::uint64_t, std::uint32_t, std::uint16_t,
+                                   std::uint8_t>);
+    const std::hash<Ids> hasher{};
+    REQUIRE(hasher(Ids{1, 2, 3}) == hasher(Ids{1, 2, 3}));
+    REQUIRE(hasher(Ids{1, 2, 3}) != hasher(Ids{1, 3, 2}));
+    const std::hash<PackedIds> packed_hasher{};
+    const PackedIds packed{'b', 1, 2, 3, 4};
+    REQUIRE(packed_hasher(packed) == packed_hasher(PackedIds{'b', 1, 2, 3, 4}));
+    REQUIRE(packed_hasher(packed) != packed_hasher(PackedIds{'s', 1, 2, 3, 4}));
+  }
+  SECTION("Custom Hash Of Padding Free Elements") {
+    using Versioned = mguid::NamedTuple<mguid::NamedType<"id", VersionedId>,
+                                        mguid::NamedType<"desk", std::uint32_t>>;
+    REQUIRE_FALSE(mguid::byte_hashable_v<Versioned, VersionedId, std::uint32_t>);
+    const Versioned lhs{VersionedId{1, 1}, 7U};
+    const Versioned rhs{VersionedId{1, 2}, 7U};
+    REQUIRE(lhs == rhs);
+    REQUIRE(std::hash<Versioned>{}(lhs) == std::hash<Versioned>{}(rhs));
+  }
+  SECTION("Floating Point Is Hashed By Value") {
+    using Prices =
+        mguid::NamedTuple<mguid::NamedType<"bid", double>, mguid::NamedType<"ask", double>>;
+    REQUIRE_FALSE(mguid::byte_hashable_v<Prices, double, double>);
+    REQUIRE(std::hash<Prices>{}(Prices{0.0, 1.0}) == std::hash<Prices>{}(Prices{-0.0, 1.0}));
+  }
+  SECTION("Unordered Set") {
+    std::unordered_set<Key> keys;
+    keys.insert(Key{"AAPL", "XNAS", 'b'});
+    keys.insert(Key{"AAPL", "XNAS", 'b'});
+    keys.insert(Key{"MSFT", "XNAS", 's'});
+    REQUIRE(keys.size() == 2);
+    REQUIRE(keys.contains(Key{"MSFT", "XNAS", 's'}));
+  }
+}
+
+TEST_CASE("Hash Bytes") {
+  const std::array<std::byte, 13> bytes{std::byte{1}, std::byte{2}, std::byte{3}};
+  std::array<std::byte, 13> other = bytes;
+  REQUIRE(mguid::hash_bytes(bytes.data(), bytes.size()) ==
+          mguid::hash_bytes(other.data(), other.size()));
+  other[12] = std::byte{1};
+  REQUIRE(mguid::hash_bytes(bytes.data(), bytes.size()) !=
+          mguid::hash_bytes(other.data(), other.size()));
+  REQUIRE(mguid::hash_bytes(bytes.data(), 12) != mguid::hash_bytes(bytes.data(), 13));
+}
+
+TEST_CASE("Hash By Tags") {
+  using Order =
+      mguid::NamedTuple<mguid::NamedType<"id", int>, mguid::NamedType<"symbol", std::string>,
+                        mguid::NamedType<"venue", std::string>>;
+  using Lookup = mguid::NamedTuple<mguid::NamedType<"venue", std::string_view>,
+                                   mguid::NamedType<"symbol", std::string_view>>;
+
+  SECTION("Projection") {
+    REQUIRE(mguid::hash_by<"symbol", "venue">(Order{1, "AAPL", "XNAS"}) ==
+            mguid::hash_by<"symbol", "venue">(Order{2, "AAPL", "XNAS"}));
+    REQUIRE(
+        mguid::equal_by<"symbol", "venue">(Order{1, "AAPL", "XNAS"}, Order{2, "AAPL", "XNAS"}));
+    REQUIRE_FALSE(mguid::equal_by<"id">(Order{1, "AAPL", "XNAS"}, Order{2, "AAPL", "XNAS"}));
+  }
+  SECTION("Heterogeneous Lookup With A Partial Key") {
+    std::unordered_map<Order, int, mguid::HashBy<"symbol", "venue">,
+                       mguid::EqualBy<"symbol", "venue">>
+        positions;
+    positions.emplace(Order{1, "AAPL", "XNAS"}, 100);
+    positions.emplace(Order{2, "MSFT", "XNYS"}, 200);
+
+    const auto it = positions.find(Lookup{"XNYS", "MSFT"});
+    REQUIRE(it != positions.end());
+    REQUIRE(it->second == 200);
+    REQUIRE(positions.find(Lookup{"XNAS", "MSFT"}) == positions.end());
+    REQUIRE(positions.contains(Lookup{"XNAS", "AAPL"}));
+  }
+}
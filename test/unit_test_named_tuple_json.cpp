@@ -0,0 +1,206 @@
+#include "NamedTupleJson.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using Venue = mguid::NamedTuple<mguid::NamedType<"mic", std::string>,
+                                mguid::NamedType<"open", bool>>;
+using Trade =
+    mguid::NamedTuple<mguid::NamedType<"id", std::uint64_t>, mguid::NamedType<"price", double>,
+                      mguid::NamedType<"qty", std::int32_t>,
+                      mguid::NamedType<"symbol", std::string>,
+                      mguid::NamedType<"note", std::optional<std::string>>,
+                      mguid::NamedType<"venue", Venue>>;
+
+TEST_CASE("Json Keys") {
+  SECTION("Quoted At Compile Time") {
+    constexpr auto first = mguid::kJsonKey<"id", true>;
+    constexpr auto other = mguid::kJsonKey<"id", false>;
+    STATIC_REQUIRE(std::string_view{first.data(), first.size()} == R"("id":)");
+    STATIC_REQUIRE(std::string_view{other.data(), other.size()} == R"(,"id":)");
+  }
+  SECTION("Escaped At Compile Time") {
+    constexpr auto key = mguid::kJsonKey<"a\"b\\c", true>;
+    STATIC_REQUIRE(std::string_view{key.data(), key.size()} == R"("a\"b\\c":)");
+  }
+  SECTION("Serializable Types") {
+    STATIC_REQUIRE(mguid::JsonSerializable<Trade>);
+    STATIC_REQUIRE_FALSE(
+        mguid::JsonSerializable<mguid::NamedTuple<mguid::NamedType<"v", char32_t>>>);
+    STATIC_REQUIRE_FALSE(
+        mguid::JsonSerializable<mguid::NamedTuple<mguid::NamedType<"v", std::vector<int>>>>);
+    STATIC_REQUIRE_FALSE(mguid::JsonSerializable<int>);
+  }
+}
+
+TEST_CASE("Json Encoding") {
+  SECTION("Declared Order") {
+    const Trade trade{7U, 101.25, -3, std::string{"ABC"}, std::nullopt,
+                      Venue{std::string{"XNAS"}, true}};
+    REQUIRE(mguid::to_json(trade) ==
+            R"({"id":7,"price":101.25,"qty":-3,"symbol":"ABC","note":null,)"
+            R"("venue":{"mic":"XNAS","open":true}})");
+  }
+  SECTION("Appends To Existing Output") {
+    std::string out{"["};
+    mguid::to_json(Venue{std::string{"A"}, false}, out);
+    out += ',';
+    mguid::to_json(Venue{std::string{"B"}, true}, out);
+    out += ']';
+    REQUIRE(out == R"([{"mic":"A","open":false},{"mic":"B","open":true}])");
+  }
+  SECTION("Escapes Strings") {
+    const Venue venue{std::string{"quote\" slash\\ tab\t bell\x07"}, false};
+    REQUIRE(mguid::to_json(venue) ==
+            R"({"mic":"quote\" slash\\ tab\u0009 bell\u0007","open":false})");
+  }
+  SECTION("Non Finite Numbers Are Null") {
+    const mguid::NamedTuple<mguid::NamedType<"x", double>> nt{INFINITY};
+    REQUIRE(mguid::to_json(nt) == R"({"x":null})");
+  }
+}
+
+TEST_CASE("Json Decoding") {
+  SECTION("Round Trip") {
+    const Trade trade{42U, 0.1, 12, std::string{"line\nbreak \"q\""}, std::string{"n"},
+                      Venue{std::string{"XLON"}, false}};
+    REQUIRE(mguid::from_json<Trade>(mguid::to_json(trade)) == trade);
+  }
+  SECTION("Any Key Order And Whitespace") {
+    const auto trade = mguid::from_json<Trade>(R"(
+      { "venue" : { "open" : true , "mic" : "XNYS" } ,
+        "symbol" : "XYZ", "qty":5, "price" : 1e2, "id" : 3, "note": "hi" }
+    )");
+    REQUIRE(trade.has_value());
+    REQUIRE(trade->get<"id">() == 3);
+    REQUIRE(trade->get<"price">() == 100.0);
+    REQUIRE(trade->get<"qty">() == 5);
+    REQUIRE(trade->get<"symbol">() == "XYZ");
+    REQUIRE(trade->get<"note">() == "hi");
+    REQUIRE(trade->get<"venue">().get<"mic">() == "XNYS");
+    REQUIRE(trade->get<"venue">().get<"open">());
+  }
+  SECTION("Missing Keys Are Left Unchanged") {
+    Venue venue{std::string{"KEEP"}, true};
+    REQUIRE(mguid::from_json(R"({"open":false})", venue));
+    REQUIRE(venue == Venue{std::string{"KEEP"}, false});
+  }
+  SECTION("Unknown Keys Are Skipped") {
+    const auto venue = mguid::from_json<Venue>(
+        R"({"extra":{"a":[1,2,{"b":null}],"c":"}"},"mic":"X","more":[true,false,-1.5e3]})");
+    REQUIRE(venue.has_value());
+    REQUIRE(venue->get<"mic">() == "X");
+  }
+  SECTION("Unicode Escapes") {
+    const auto venue =
+        mguid::from_json<Venue>(R"({"mic":"A\u00e9\u20AC\ud83d\ude00\/","open":true})");
+    REQUIRE(venue.has_value());
+    REQUIRE(venue->get<"mic">() == "A\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80/");
+  }
+  SECTION("Escaped Keys") {
+    const auto venue = mguid::from_json<Venue>(R"({"\u006dic":"X"})");
+    REQUIRE(venue.has_value());
+    REQUIRE(venue->get<"mic">() == "X");
+  }
+  SECTION("Null Optional") {
+    Trade trade{};
+    trade.get<"note">() = "set";
+    REQUIRE(mguid::from_json(R"({"note":null})", trade));
+    REQUIRE_FALSE(trade.get<"note">().has_value());
+  }
+  SECTION("Malformed Input Is Rejected") {
+    for (const std::string_view json :
+         {R"({"mic":"X")", R"({"mic":1})", R"({"open":"true"})", R"({"mic":"X"} trailing)",
+          R"({"mic":"\ud800"})", R"({"mic":"\q"})", R"({"mic" "X"})", R"([])", R"({"x":[1,})",
+          R"({"mic":"X",})", ""}) {
+      INFO(json);
+      REQUIRE_FALSE(mguid::from_json<Venue>(json).has_value());
+    }
+    REQUIRE_FALSE(mguid::from_json<Trade>(R"({"id":-1})").has_value());
+    REQUIRE_FALSE(mguid::from_json<Trade>(R"({"qty":1.5})").has_value());
+    REQUIRE_FALSE(mguid::from_json<Trade>(R"({"qty":99999999999})").has_value());
+  }
+  SECTION("Numbers Follow The Json Grammar") {
+    for (const std::string_view json :
+         {R"({"price":nan,"qty":1})", R"({"price":inf,"qty":007})", R"({"extra":infinity})",
+          R"({"price":NaN})", R"({"price":Infinity})", R"({"qty":007})", R"({"price":00.5})",
+          R"({"price":.5})", R"({"price":1.})", R"({"price":+1})", R"({"price":1e})",
+          R"({"price":-})", R"({"extra":-nan})"}) {
+      INFO(json);
+      REQUIRE_FALSE(mguid::from_json<Trade>(json).has_value());
+    }
+    const auto trade = mguid::from_json<Trade>(R"({"price":-0.5E+1,"qty":-0,"id":0})");
+    REQUIRE(trade.has_value());
+    REQUIRE(trade->get<"price">() == -5.0);
+    REQUIRE(trade->get<"qty">() == 0);
+  }
+  SECTION("Null Floating Point Is NaN") {
+    const auto trade = mguid::from_json<Trade>(R"({"price":null})");
+    REQUIRE(trade.has_value());
+    REQUIRE(std::isnan(trade->get<"price">()));
+  }
+  SECTION("Unknown Values Nested Too Deep Are Rejected") {
+    const std::string deep = R"({"x":)" + std::string(100, '[') + std::string(100, ']') + "}";
+    REQUIRE_FALSE(mguid::from_json<Venue>(deep).has_value());
+  }
+}
+
+TEST_CASE("Json Stream Decoding") {
+  const std::vector<Venue> expected{Venue{std::string{"A"}, true},
+                                    Venue{std::string{"B{\"}"}, false},
+                                    Venue{std::string{"C"}, true}};
+  std::string stream{};
+  for (const auto& venue : expected) {
+    mguid::to_json(venue, stream);
+    stream += '\n';
+  }
+
+  SECTION("Whole Stream") {
+    std::vector<Venue> decoded{};
+    mguid::JsonStreamDecoder<Venue> decoder{};
+    REQUIRE(decoder.feed(stream, [&decoded](Venue&& venue) { decoded.push_back(venue); }));
+    REQUIRE(decoder.idle());
+    REQUIRE(decoded == expected);
+  }
+  SECTION("Split At Every Position") {
+    for (std::size_t split{0}; split <= stream.size(); ++split) {
+      std::vector<Venue> decoded{};
+      mguid::JsonStreamDecoder<Venue> decoder{};
+      const auto collect = [&decoded](Venue&& venue) { decoded.push_back(venue); };
+      REQUIRE(decoder.feed(std::string_view{stream}.substr(0, split), collect));
+      REQUIRE(decoder.feed(std::string_view{stream}.substr(split), collect));
+      REQUIRE(decoder.idle());
+      REQUIRE(decoded == expected);
+    }
+  }
+  SECTION("One Character At A Time") {
+    std::vector<Venue> decoded{};
+    mguid::JsonStreamDecoder<Venue> decoder{};
+    for (const char c : stream) {
+      REQUIRE(decoder.feed(std::string_view{&c, 1},
+                           [&decoded](Venue&& venue) { decoded.push_back(venue); }));
+    }
+    REQUIRE(decoded == expected);
+  }
+  SECTION("Malformed Record Stops The Stream") {
+    std::vector<Venue> decoded{};
+    mguid::JsonStreamDecoder<Venue> decoder{};
+    REQUIRE_FALSE(decoder.feed(R"({"mic":"A"} {"mic":1} {"mic":"C"})",
+                               [&decoded](Venue&& venue) { decoded.push_back(venue); }));
+    REQUIRE(decoded.size() == 1);
+    REQUIRE(decoder.idle());
+  }
+  SECTION("Partial Record Is Pending") {
+    mguid::JsonStreamDecoder<Venue> decoder{};
+    REQUIRE(decoder.feed(R"({"mic":)", [](Venue&&) {}));
+    REQUIRE_FALSE(decoder.idle());
+    decoder.reset();
+    REQUIRE(decoder.idle());
+  }
+}
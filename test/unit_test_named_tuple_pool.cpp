@@ -0,0 +1,99 @@
+#include "NamedTuplePool.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+// every test uses its own record type so that it starts with fresh per-thread heaps
+template <mguid::StringLiteral Tag>
+using Record =
+    mguid::NamedTuple<mguid::NamedType<Tag, std::int64_t>, mguid::NamedType<"name", std::string>>;
+
+TEST_CASE("NamedTuplePool Make") {
+  using Pool = mguid::NamedTuplePool<Record<"make">>;
+
+  auto record = Pool::make(std::int64_t{7}, "seven");
+  REQUIRE(record->get<"make">() == 7);
+  REQUIRE(record->get<"name">() == "seven");
+  REQUIRE(reinterpret_cast<std::uintptr_t>(record.get()) % alignof(Record<"make">) == 0);
+  REQUIRE(Pool::local_slab_count() == 1);
+
+  const auto* address = record.get();
+  record.reset();
+  auto reused = Pool::acquire();
+  REQUIRE(reused.get() == address);
+  REQUIRE(reused->get<"name">().empty());
+}
+
+TEST_CASE("NamedTuplePool Slabs") {
+  using Pool = mguid::NamedTuplePool<Record<"slabs">>;
+
+  std::vector<Pool::Handle> records;
+  for (std::size_t index{0}; index < Pool::kSlotsPerSlab + 1; ++index) {
+    records.push_back(Pool::make(static_cast<std::int64_t>(index), ""));
+  }
+  REQUIRE(Pool::local_slab_count() == 2);
+  REQUIRE(records.back()->get<"slabs">() == static_cast<std::int64_t>(Pool::kSlotsPerSlab));
+
+  records.clear();
+  for (std::size_t index{0}; index < Pool::kSlotsPerSlab + 1; ++index) {
+    records.push_back(Pool::acquire());
+  }
+  REQUIRE(Pool::local_slab_count() == 2);
+}
+
+TEST_CASE("NamedTuplePool Cross Thread Release") {
+  using Pool = mguid::NamedTuplePool<Record<"remote">>;
+
+  SECTION("Returned To The Owner") {
+    std::vector<Pool::Handle> records;
+    for (int index{0}; index < 8; ++index) { records.push_back(Pool::make(index, "x")); }
+    std::vector<const void*> addresses;
+    for (const auto& record : records) { addresses.push_back(record.get()); }
+
+    std::thread{[&records] { records.clear(); }}.join();
+
+    // all eight come back in one batch from the remote list
+    for (int index{0}; index < 8; ++index) {
+      auto record = Pool::acquire();
+      REQUIRE(std::ranges::find(addresses, record.get()) != addresses.end());
+      record.release();
+    }
+    REQUIRE(Pool::local_slab_count() == 1);
+  }
+  SECTION("Outlives The Owner") {
+    Pool::Handle record;
+    std::thread{[&record] { record = Pool::make(std::int64_t{1}, "orphan"); }}.join();
+    REQUIRE(record->get<"name">() == "orphan");
+    const void* address{record.get()};
+    record.reset();
+
+    // the next thread adopts the heap of the exited thread, including the record returned to it
+    const void* adopted{nullptr};
+    std::thread{[&adopted] {
+      auto reused = Pool::acquire();
+      adopted = reused.get();
+    }}.join();
+    REQUIRE(adopted == address);
+  }
+}
+
+TEST_CASE("NamedTuplePool Keep Constructed") {
+  using Pool = mguid::NamedTuplePool<Record<"keep">, true>;
+
+  auto record = Pool::acquire();
+  REQUIRE(record->get<"keep">() == 0);
+  record->get<"name">().assign(200, 'k');
+  const auto* address = record.get();
+  record.reset();
+
+  auto reused = Pool::acquire();
+  REQUIRE(reused.get() == address);
+  REQUIRE(reused->get<"name">().capacity() >= 200);
+  reused->get<"name">().clear();
+  REQUIRE(reused->get<"name">().capacity() >= 200);
+}
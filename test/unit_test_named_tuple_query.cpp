@@ -0,0 +1,229 @@
+#include "NamedTupleAlgorithms.hpp"
+#include "NamedTupleQuery.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using Fill = mguid::NamedTupleColumns<
+    mguid::NamedType<"symbol", std::string>, mguid::NamedType<"side", char>,
+    mguid::NamedType<"price", double>, mguid::NamedType<"qty", std::int64_t>>;
+
+namespace {
+Fill make_fills() {
+  Fill fills;
+  fills.emplace_back("ABC", 'B', 10.0, 100);
+  fills.emplace_back("XYZ", 'S', 20.0, 250);
+  fills.emplace_back("ABC", 'S', 11.0, 300);
+  fills.emplace_back("DEF", 'B', 5.0, 50);
+  fills.emplace_back("XYZ", 'B', 21.0, 400);
+  fills.emplace_back("ABC", 'B', 12.0, 150);
+  return fills;
+}
+
+// enough rows for several chunks, with qty cycling through 0 to 999
+Fill make_many_fills(std::size_t count) {
+  const std::vector<std::string> symbols{"ABC", "DEF", "GHI", "JKL", "MNO", "PQR", "STU"};
+  Fill fills;
+  fills.reserve(count);
+  for (std::size_t index{0}; index < count; ++index) {
+    fills.emplace_back(symbols[index % symbols.size()], index % 3 == 0 ? 'S' : 'B',
+                       static_cast<double>(index % 100), static_cast<std::int64_t>(index % 1000));
+  }
+  return fills;
+}
+
+template <typename Columns>
+bool same_rows(const Columns& lhs, const Columns& rhs) {
+  if (lhs.size() != rhs.size()) { return false; }
+  for (std::size_t index{0}; index < lhs.size(); ++index) {
+    if (lhs[index].to_tuple() != rhs[index].to_tuple()) { return false; }
+  }
+  return true;
+}
+}  // namespace
+
+TEST_CASE("Query Predicates") {
+  REQUIRE(mguid::eq(3)(3));
+  REQUIRE_FALSE(mguid::ne(3)(3));
+  REQUIRE(mguid::lt(3)(2));
+  REQUIRE_FALSE(mguid::lt(3)(3));
+  REQUIRE(mguid::le(3)(3));
+  REQUIRE(mguid::gt(3)(4));
+  REQUIRE_FALSE(mguid::gt(3)(3));
+  REQUIRE(mguid::ge(3)(3));
+  REQUIRE(mguid::between(2, 4)(2));
+  REQUIRE(mguid::between(2, 4)(4));
+  REQUIRE_FALSE(mguid::between(2, 4)(5));
+}
+
+TEST_CASE("Query Where") {
+  const auto fills = make_fills();
+  SECTION("No Filter") {
+    REQUIRE(mguid::scan(fills).count() == fills.size());
+    REQUIRE(same_rows(mguid::scan(fills).collect(), fills));
+  }
+  SECTION("One Filter") {
+    const auto query = mguid::scan(fills).where<"qty">(mguid::gt(std::int64_t{100}));
+    REQUIRE(query.count() == 4);
+    const auto selected = query.collect();
+    REQUIRE(selected.size() == 4);
+    REQUIRE(selected[0].to_tuple() == fills[1].to_tuple());
+    REQUIRE(selected[1].to_tuple() == fills[2].to_tuple());
+    REQUIRE(selected[2].to_tuple() == fills[4].to_tuple());
+    REQUIRE(selected[3].to_tuple() == fills[5].to_tuple());
+  }
+  SECTION("Several Filters") {
+    const auto selected = mguid::scan(fills)
+                              .where<"qty">(mguid::gt(std::int64_t{100}))
+                              .where<"side">(mguid::eq('B'))
+                              .where<"symbol">([](const std::string& symbol) {
+                                return symbol != "XYZ";
+                              })
+                              .collect();
+    REQUIRE(selected.size() == 1);
+    REQUIRE(selected[0].to_tuple() == fills[5].to_tuple());
+  }
+  SECTION("Nothing Selected") {
+    const auto query = mguid::scan(fills).where<"price">(mguid::lt(0.0));
+    REQUIRE(query.count() == 0);
+    REQUIRE(query.collect().empty());
+  }
+  SECTION("Empty") {
+    const Fill empty{};
+    REQUIRE(mguid::scan(empty).count() == 0);
+    REQUIRE(mguid::scan(empty).collect().empty());
+  }
+}
+
+TEST_CASE("Query Aggregate") {
+  const auto fills = make_fills();
+  SECTION("All Rows") {
+    const auto totals =
+        mguid::scan(fills).agg(mguid::sum_of<"qty">, mguid::min_of<"price", "low">,
+                               mguid::max_of<"price", "high">, mguid::mean_of<"price", "mean">,
+                               mguid::count_of);
+    REQUIRE(totals.get<"qty">() == 1250);
+    REQUIRE(totals.get<"low">() == 5.0);
+    REQUIRE(totals.get<"high">() == 21.0);
+    REQUIRE(totals.get<"mean">() == 79.0 / 6.0);
+    REQUIRE(totals.get<"count">() == 6);
+  }
+  SECTION("Filtered") {
+    const auto totals = mguid::scan(fills)
+                            .where<"side">(mguid::eq('S'))
+                            .agg(mguid::sum_of<"qty", "volume">, mguid::CountOf<"fills">{});
+    REQUIRE(totals.get<"volume">() == 550);
+    REQUIRE(totals.get<"fills">() == 2);
+  }
+  SECTION("Nothing Selected") {
+    const auto totals = mguid::scan(fills)
+                            .where<"qty">(mguid::lt(std::int64_t{0}))
+                            .agg(mguid::sum_of<"qty">, mguid::max_of<"price">,
+                                 mguid::mean_of<"price", "mean">, mguid::count_of);
+    REQUIRE(totals.get<"qty">() == 0);
+    REQUIRE(totals.get<"price">() == 0.0);
+    REQUIRE(totals.get<"mean">() == 0.0);
+    REQUIRE(totals.get<"count">() == 0);
+  }
+}
+
+TEST_CASE("Query Sum Widens") {
+  using Narrow = mguid::NamedTupleColumns<mguid::NamedType<"qty", std::int32_t>,
+                                          mguid::NamedType<"lots", std::uint8_t>,
+                                          mguid::NamedType<"size", float>>;
+  Narrow rows;
+  rows.emplace_back(2'000'000'000, std::uint8_t{200}, 0.5F);
+  rows.emplace_back(2'000'000'000, std::uint8_t{200}, 0.5F);
+  rows.emplace_back(-1, std::uint8_t{200}, 0.5F);
+  const auto totals =
+      mguid::scan(rows).agg(mguid::sum_of<"qty">, mguid::sum_of<"lots">, mguid::sum_of<"size">);
+  STATIC_REQUIRE(std::is_same_v<std::remove_cvref_t<decltype(totals)>,
+                                mguid::NamedTuple<mguid::NamedType<"qty", std::int64_t>,
+                                                  mguid::NamedType<"lots", std::uint64_t>,
+                                                  mguid::NamedType<"size", double>>>);
+  REQUIRE(totals.get<"qty">() == 3'999'999'999);
+  REQUIRE(totals.get<"lots">() == 600);
+  REQUIRE(totals.get<"size">() == 1.5);
+  const auto groups = mguid::scan(rows).group_by<"lots">().agg(mguid::sum_of<"qty", "total">);
+  REQUIRE(groups.column<"total">()[0] == 3'999'999'999);
+}
+
+TEST_CASE("Query Group By") {
+  const auto fills = make_fills();
+  SECTION("One Key") {
+    const auto groups = mguid::scan(fills)
+                            .where<"qty">(mguid::ge(std::int64_t{100}))
+                            .group_by<"symbol">()
+                            .agg(mguid::sum_of<"qty">, mguid::max_of<"price">, mguid::count_of);
+    REQUIRE(groups.size() == 2);
+    // groups appear in the order they are first seen on one thread
+    REQUIRE(groups.column<"symbol">()[0] == "ABC");
+    REQUIRE(groups.column<"qty">()[0] == 550);
+    REQUIRE(groups.column<"price">()[0] == 12.0);
+    REQUIRE(groups.column<"count">()[0] == 3);
+    REQUIRE(groups.column<"symbol">()[1] == "XYZ");
+    REQUIRE(groups.column<"qty">()[1] == 650);
+    REQUIRE(groups.column<"price">()[1] == 21.0);
+    REQUIRE(groups.column<"count">()[1] == 2);
+  }
+  SECTION("Two Keys") {
+    auto groups = mguid::scan(fills).group_by<"symbol", "side">().agg(mguid::count_of);
+    using Counts = decltype(groups)::RowType;
+    mguid::sort_by<"symbol", "side">(groups);
+    REQUIRE(groups.size() == 5);
+    REQUIRE(groups[0].to_tuple() == Counts{"ABC", 'B', 2});
+    REQUIRE(groups[1].to_tuple() == Counts{"ABC", 'S', 1});
+    REQUIRE(groups[2].to_tuple() == Counts{"DEF", 'B', 1});
+    REQUIRE(groups[3].to_tuple() == Counts{"XYZ", 'B', 1});
+    REQUIRE(groups[4].to_tuple() == Counts{"XYZ", 'S', 1});
+  }
+  SECTION("Empty") {
+    const Fill empty{};
+    REQUIRE(mguid::scan(empty).group_by<"symbol">().agg(mguid::count_of).empty());
+  }
+}
+
+TEST_CASE("Query Threads") {
+  const auto fills = make_many_fills(10 * mguid::kQueryChunkRows + 123);
+  const auto query = mguid::scan(fills)
+                         .where<"qty">(mguid::between(std::int64_t{100}, std::int64_t{899}))
+                         .where<"side">(mguid::eq('B'));
+  for (const std::size_t threads : {std::size_t{2}, std::size_t{4}, std::size_t{16}}) {
+    const auto parallel = query.threads(threads);
+    REQUIRE(parallel.count() == query.count());
+    REQUIRE(same_rows(parallel.collect(), query.collect()));
+
+    const auto totals = parallel.agg(mguid::sum_of<"qty">, mguid::min_of<"price">);
+    REQUIRE(totals == query.agg(mguid::sum_of<"qty">, mguid::min_of<"price">));
+
+    auto serial_groups =
+        query.group_by<"symbol">().agg(mguid::sum_of<"qty">, mguid::mean_of<"price", "mean">);
+    auto parallel_groups =
+        parallel.group_by<"symbol">().agg(mguid::sum_of<"qty">, mguid::mean_of<"price", "mean">);
+    mguid::sort_by<"symbol">(serial_groups);
+    mguid::sort_by<"symbol">(parallel_groups);
+    REQUIRE(parallel_groups.size() == 7);
+    // the prices are small integers, so the sums behind the means are exact in any order
+    REQUIRE(same_rows(parallel_groups, serial_groups));
+  }
+  REQUIRE(query.threads(0).count() == query.count());
+}
+
+TEST_CASE("Query Threads Rethrow") {
+  const auto fills = make_many_fills(10 * mguid::kQueryChunkRows + 123);
+  const auto query = mguid::scan(fills).where<"qty">([](std::int64_t qty) {
+    if (qty == 999) { throw std::runtime_error{"bad qty"}; }
+    return qty > 100;
+  });
+  for (const std::size_t threads : {std::size_t{1}, std::size_t{2}, std::size_t{4}}) {
+    const auto parallel = query.threads(threads);
+    REQUIRE_THROWS_AS(parallel.count(), std::runtime_error);
+    REQUIRE_THROWS_AS(parallel.collect(), std::runtime_error);
+    REQUIRE_THROWS_AS(parallel.group_by<"symbol">().agg(mguid::count_of), std::runtime_error);
+  }
+}
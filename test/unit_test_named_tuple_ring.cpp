@@ -0,0 +1,221 @@
+#include "NamedTupleRing.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using Tick = mguid::NamedTuple<mguid::NamedType<"seq", std::uint64_t>,
+                               mguid::NamedType<"price", double>>;
+using Message = mguid::NamedTuple<mguid::NamedType<"seq", std::uint64_t>,
+                                  mguid::NamedType<"text", std::string>>;
+
+TEST_CASE("NamedTupleRing Slots") {
+  STATIC_REQUIRE(mguid::plain_slots_v<Tick>);
+  STATIC_REQUIRE(!mguid::plain_slots_v<Message>);
+  STATIC_REQUIRE(mguid::NamedTupleRing<Tick, 8>::capacity() == 8);
+}
+
+TEMPLATE_TEST_CASE("NamedTupleRing Single Thread", "", (mguid::NamedTupleRing<Tick, 4>),
+                   (mguid::MpmcNamedTupleRing<Tick, 4>)) {
+  TestType ring;
+  REQUIRE(ring.empty());
+  REQUIRE(!ring.try_pop().has_value());
+
+  SECTION("Full") {
+    for (std::uint64_t seq{0}; seq < 4; ++seq) { REQUIRE(ring.try_emplace(seq, 1.0)); }
+    REQUIRE(ring.size() == 4);
+    REQUIRE(!ring.try_emplace(std::uint64_t{4}, 1.0));
+    REQUIRE(ring.try_pop()->template get<"seq">() == 0);
+    REQUIRE(ring.try_push(Tick{std::uint64_t{4}, 1.0}));
+  }
+  SECTION("Named Emplace") {
+    REQUIRE(ring.try_emplace(mguid::NamedTypeV<"price">(2.5), mguid::NamedTypeV<"seq">(7U)));
+    Tick out;
+    REQUIRE(ring.try_pop(out));
+    REQUIRE(out == Tick{std::uint64_t{7}, 2.5});
+  }
+  SECTION("Wrap Around In Order") {
+    std::uint64_t pushed{0};
+    std::uint64_t popped{0};
+    for (int round{0}; round < 10; ++round) {
+      while (ring.try_emplace(pushed, 0.5)) { ++pushed; }
+      std::array<Tick, 3> out;
+      const auto count = ring.pop_n(std::span{out});
+      REQUIRE(count == 3);
+      for (std::size_t index{0}; index < count; ++index) {
+        REQUIRE(out[index].template get<"seq">() == popped++);
+      }
+    }
+  }
+  SECTION("Pop Into Columns") {
+    for (std::uint64_t seq{0}; seq < 3; ++seq) { REQUIRE(ring.try_emplace(seq, 1.0)); }
+    REQUIRE(ring.try_pop().has_value());
+    for (std::uint64_t seq{3}; seq < 5; ++seq) { REQUIRE(ring.try_emplace(seq, 2.0)); }
+
+    mguid::ColumnsOf<Tick>::type columns;
+    REQUIRE(ring.pop_n(columns, 3) == 3);
+    REQUIRE(ring.pop_n(columns, 8) == 1);
+    REQUIRE(columns.size() == 4);
+    for (std::uint64_t index{0}; index < 4; ++index) {
+      REQUIRE(columns.template column<"seq">()[index] == index + 1);
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("NamedTupleRing Non Trivial Records", "", (mguid::NamedTupleRing<Message, 4>),
+                   (mguid::MpmcNamedTupleRing<Message, 4>)) {
+  const std::string long_text(64, 'm');
+  {
+    TestType ring;
+    REQUIRE(ring.try_emplace(std::uint64_t{1}, long_text));
+    REQUIRE(ring.try_emplace(std::uint64_t{2}, long_text));
+    REQUIRE(ring.try_emplace(std::uint64_t{3}, "short"));
+
+    std::array<Message, 1> out;
+    REQUIRE(ring.pop_n(std::span{out}) == 1);
+    REQUIRE(out[0].template get<"text">() == long_text);
+
+    mguid::ColumnsOf<Message>::type columns;
+    REQUIRE(ring.pop_n(columns, 1) == 1);
+    REQUIRE(columns.template column<"seq">()[0] == 2);
+
+    // the last record is destroyed with the ring
+    REQUIRE(ring.size() == 1);
+  }
+}
+
+namespace {
+// throws when constructed from a negative value, or when moved once moves_left reaches zero
+struct Fragile {
+  // a negative count never fails
+  static inline int moves_left{-1};
+
+  static void move_or_throw() {
+    if (moves_left == 0) { throw std::runtime_error("move"); }
+    if (moves_left > 0) { --moves_left; }
+  }
+
+  explicit Fragile(int init_value) : value{init_value} {
+    if (init_value < 0) { throw std::runtime_error("negative"); }
+  }
+  Fragile(const Fragile&) = default;
+  Fragile(Fragile&& other) : value{other.value} { move_or_throw(); }
+  Fragile& operator=(const Fragile&) = default;
+  Fragile& operator=(Fragile&& other) {
+    move_or_throw();
+    value = other.value;
+    return *this;
+  }
+  ~Fragile() = default;
+
+  int value;
+};
+}  // namespace
+
+using Fragiles = mguid::NamedTuple<mguid::NamedType<"f", Fragile>>;
+
+TEMPLATE_TEST_CASE("NamedTupleRing Throwing Records", "", (mguid::NamedTupleRing<Fragiles, 4>),
+                   (mguid::MpmcNamedTupleRing<Fragiles, 4>)) {
+  constexpr bool kMulti{std::is_same_v<TestType, mguid::MpmcNamedTupleRing<Fragiles, 4>>};
+  TestType ring;
+  Fragile::moves_left = -1;
+
+  SECTION("Throwing Producer") {
+    for (int round{0}; round < 6; ++round) {
+      REQUIRE_THROWS_AS(ring.try_emplace(-1), std::runtime_error);
+      REQUIRE(ring.try_emplace(round));
+      const auto popped = ring.try_pop();
+      REQUIRE(popped.has_value());
+      REQUIRE(popped->template get<"f">().value == round);
+      REQUIRE(!ring.try_pop().has_value());
+    }
+  }
+  SECTION("Throwing Consumer") {
+    REQUIRE(ring.try_emplace(1));
+    REQUIRE(ring.try_emplace(2));
+    Fragile::moves_left = 0;
+    REQUIRE_THROWS_AS(ring.try_pop(), std::runtime_error);
+    Fragile::moves_left = -1;
+    const auto popped = ring.try_pop();
+    REQUIRE(popped.has_value());
+    // the single consumer ring keeps the record, the multi consumer ring drops it
+    REQUIRE(popped->template get<"f">().value == (kMulti ? 2 : 1));
+  }
+  SECTION("Throwing Batch Consumer") {
+    REQUIRE(ring.try_emplace(1));
+    REQUIRE(ring.try_emplace(2));
+    REQUIRE(ring.try_emplace(3));
+    std::vector<Fragiles> out(3, Fragiles{Fragile{0}});
+    Fragile::moves_left = 1;
+    REQUIRE_THROWS_AS(ring.pop_n(std::span{out}), std::runtime_error);
+    Fragile::moves_left = -1;
+    REQUIRE(out[0].template get<"f">().value == 1);
+    // the record moved out before the throw is popped, the one that threw is kept or dropped
+    REQUIRE(ring.size() == (kMulti ? 1 : 2));
+    const auto popped = ring.try_pop();
+    REQUIRE(popped.has_value());
+    REQUIRE(popped->template get<"f">().value == (kMulti ? 3 : 2));
+  }
+}
+
+TEST_CASE("NamedTupleRing Threads") {
+  constexpr std::uint64_t kCount{100'000};
+
+  SECTION("Single Producer Single Consumer") {
+    auto ring = std::make_unique<mguid::NamedTupleRing<Tick, 64>>();
+    std::thread producer{[&ring] {
+      for (std::uint64_t seq{0}; seq < kCount;) {
+        if (ring->try_emplace(seq, static_cast<double>(seq))) { ++seq; }
+      }
+    }};
+
+    std::uint64_t expected{0};
+    std::uint64_t out_of_order{0};
+    std::array<Tick, 16> out;
+    while (expected < kCount) {
+      const auto count = ring->pop_n(std::span{out});
+      for (std::size_t index{0}; index < count; ++index) {
+        out_of_order += out[index].get<"seq">() == expected ? 0 : 1;
+        ++expected;
+      }
+    }
+    producer.join();
+    REQUIRE(out_of_order == 0);
+    REQUIRE(ring->empty());
+  }
+  SECTION("Multi Producer Multi Consumer") {
+    auto ring = std::make_unique<mguid::MpmcNamedTupleRing<Tick, 64>>();
+    constexpr std::size_t kThreads{2};
+    std::vector<std::thread> threads;
+    std::array<std::uint64_t, kThreads> sums{};
+    std::atomic<std::uint64_t> consumed{0};
+
+    for (std::size_t thread{0}; thread < kThreads; ++thread) {
+      threads.emplace_back([&ring, thread] {
+        for (std::uint64_t seq{thread}; seq < kCount; seq += kThreads) {
+          while (!ring->try_emplace(seq, 0.0)) {}
+        }
+      });
+      threads.emplace_back([&ring, &sums, &consumed, thread] {
+        while (consumed.load() < kCount) {
+          if (auto tick = ring->try_pop()) {
+            sums[thread] += tick->get<"seq">();
+            consumed.fetch_add(1);
+          }
+        }
+      });
+    }
+    for (auto& thread : threads) { thread.join(); }
+    REQUIRE(std::accumulate(sums.begin(), sums.end(), std::uint64_t{0}) ==
+            kCount * (kCount - 1) / 2);
+  }
+}
@@ -0,0 +1,121 @@
+#include "NamedTupleSerialization.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <type_traits>
+
+using Order =
+    mguid::NamedTuple<mguid::NamedType<"id", std::uint64_t>, mguid::NamedType<"side", char>,
+                      mguid::NamedType<"price", double>, mguid::NamedType<"qty", std::int32_t>>;
+using Renamed =
+    mguid::NamedTuple<mguid::NamedType<"id", std::uint64_t>, mguid::NamedType<"side", char>,
+                      mguid::NamedType<"price", double>, mguid::NamedType<"size", std::int32_t>>;
+using Retyped =
+    mguid::NamedTuple<mguid::NamedType<"id", std::uint64_t>, mguid::NamedType<"side", char>,
+                      mguid::NamedType<"price", float>, mguid::NamedType<"qty", std::int32_t>>;
+
+TEST_CASE("Binary Layout") {
+  SECTION("Packed Size") { REQUIRE(mguid::serialized_size_v<Order> == 8 + 8 + 1 + 8 + 4); }
+  SECTION("Declared Order Offsets") {
+    REQUIRE(mguid::BinaryLayout<Order>::offsets == std::array<std::size_t, 4>{8, 16, 17, 25});
+  }
+  SECTION("Fingerprint Depends On Tags And Types") {
+    REQUIRE(mguid::BinaryLayout<Order>::fingerprint != mguid::BinaryLayout<Renamed>::fingerprint);
+    REQUIRE(mguid::BinaryLayout<Order>::fingerprint != mguid::BinaryLayout<Retyped>::fingerprint);
+  }
+  SECTION("Only Trivially Copyable Elements") {
+    using WithString = mguid::NamedTuple<mguid::NamedType<"name", std::string>>;
+    REQUIRE(mguid::BinarySerializable<Order>);
+    REQUIRE_FALSE(mguid::BinarySerializable<WithString>);
+  }
+}
+
+TEST_CASE("Binary Serialization") {
+  const Order order{42, 'b', 101.25, 300};
+  std::array<std::byte, mguid::serialized_size_v<Order>> buffer{};
+
+  SECTION("Round Trip") {
+    REQUIRE(mguid::serialize(order, buffer) == buffer.size());
+    const auto result = mguid::deserialize<Order>(buffer);
+    REQUIRE(result.has_value());
+    REQUIRE(*result == order);
+  }
+  SECTION("Deserialize Into Existing Tuple") {
+    REQUIRE(mguid::serialize(order, buffer) == buffer.size());
+    Order result{};
+    REQUIRE(mguid::deserialize(std::span<const std::byte>{buffer}, result));
+    REQUIRE(result == order);
+  }
+  SECTION("Buffer Too Small To Serialize") {
+    REQUIRE(mguid::serialize(order, std::span{buffer}.first(buffer.size() - 1)) == 0);
+  }
+  SECTION("Buffer Too Small To Deserialize") {
+    mguid::serialize(order, buffer);
+    REQUIRE_FALSE(mguid::deserialize<Order>(std::span{buffer}.first(buffer.size() - 1)));
+  }
+  SECTION("Schema Mismatch Is Rejected") {
+    mguid::serialize(order, buffer);
+    REQUIRE_FALSE(mguid::deserialize<Renamed>(buffer));
+    REQUIRE_FALSE(mguid::deserialize<Retyped>(buffer));
+    REQUIRE(mguid::read_fingerprint(buffer) == mguid::BinaryLayout<Order>::fingerprint);
+  }
+  SECTION("Unaligned Buffer") {
+    std::array<std::byte, mguid::serialized_size_v<Order> + 1> unaligned{};
+    const auto span = std::span{unaligned}.subspan(1);
+    REQUIRE(mguid::serialize(order, span) == span.size());
+    REQUIRE(mguid::deserialize<Order>(span) == order);
+  }
+}
+
+namespace {
+// trivially copyable without a default constructor
+struct Price {
+  explicit constexpr Price(std::int64_t init_ticks) : ticks{init_ticks} {}
+  std::int64_t ticks;
+};
+}  // namespace
+
+TEST_CASE("Binary View") {
+  const Order order{7, 's', 99.5, -12};
+  std::array<std::byte, mguid::serialized_size_v<Order>> buffer{};
+  mguid::serialize(order, buffer);
+
+  SECTION("Get By Tag") {
+    const auto view = mguid::BinaryView<Order>::from(buffer);
+    REQUIRE(view.has_value());
+    REQUIRE(view->get<"id">() == 7);
+    REQUIRE(view->get<"side">() == 's');
+    REQUIRE(view->get<"price">() == 99.5);
+    REQUIRE(view->get<"qty">() == -12);
+  }
+  SECTION("Get By Index") {
+    const auto view = mguid::BinaryView<Order>::from(buffer);
+    REQUIRE(view.has_value());
+    REQUIRE(std::is_same_v<decltype(view->get<2>()), double>);
+    REQUIRE(view->get<2>() == 99.5);
+  }
+  SECTION("Views Buffer Without Copying") {
+    const auto view = mguid::BinaryView<Order>::from(buffer);
+    REQUIRE(view->bytes().data() == buffer.data());
+    REQUIRE(view->size() == 4);
+  }
+  SECTION("To Tuple") { REQUIRE(mguid::BinaryView<Order>::from(buffer)->to_tuple() == order); }
+  SECTION("Elements Without A Default Constructor") {
+    using Quote = mguid::NamedTuple<mguid::NamedType<"id", std::uint32_t>,
+                                    mguid::NamedType<"price", Price>>;
+    std::array<std::byte, mguid::serialized_size_v<Quote>> quote_buffer{};
+    REQUIRE(mguid::serialize(Quote{7U, Price{12'345}}, quote_buffer) == quote_buffer.size());
+    const auto view = mguid::BinaryView<Quote>::from(quote_buffer);
+    REQUIRE(view.has_value());
+    REQUIRE(view->get<"price">().ticks == 12'345);
+    REQUIRE(view->get<"id">() == 7U);
+  }
+  SECTION("Schema Mismatch Is Rejected") {
+    REQUIRE_FALSE(mguid::BinaryView<Renamed>::from(buffer).has_value());
+  }
+}
@@ -0,0 +1,119 @@
+#include "NamedTupleTranspose.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+using Row = mguid::NamedTuple<mguid::NamedType<"id", std::uint32_t>,
+                              mguid::NamedType<"ts", std::int64_t>,
+                              mguid::NamedType<"flags", std::uint8_t>,
+                              mguid::NamedType<"price", double>,
+                              mguid::NamedType<"qty", float>,
+                              mguid::NamedType<"symbol", std::string>>;
+
+namespace {
+
+std::vector<Row> make_rows(std::size_t count) {
+  std::vector<Row> rows;
+  rows.reserve(count);
+  for (std::size_t index{0}; index < count; ++index) {
+    rows.emplace_back(static_cast<std::uint32_t>(index * 3), static_cast<std::int64_t>(index) - 7,
+                      static_cast<std::uint8_t>(index), static_cast<double>(index) * 0.5,
+                      static_cast<float>(index) + 0.25f, std::to_string(index));
+  }
+  return rows;
+}
+
+}  // namespace
+
+TEST_CASE("Strided Gather And Scatter") {
+  struct Record {
+    std::uint64_t wide;
+    std::uint32_t narrow;
+    std::uint8_t pad;
+  };
+  std::array<Record, 13> records{};
+  for (std::size_t index{0}; index < records.size(); ++index) {
+    records[index] = Record{index * 1000, static_cast<std::uint32_t>(index * 10), 0};
+  }
+
+  std::array<std::uint64_t, 13> wide{};
+  std::array<std::uint32_t, 13> narrow{};
+  mguid::gather_strided(reinterpret_cast<const std::byte*>(&records[0].wide), sizeof(Record),
+                        wide.data(), wide.size());
+  mguid::gather_strided(reinterpret_cast<const std::byte*>(&records[0].narrow), sizeof(Record),
+                        narrow.data(), narrow.size());
+  for (std::size_t index{0}; index < records.size(); ++index) {
+    REQUIRE(wide[index] == records[index].wide);
+    REQUIRE(narrow[index] == records[index].narrow);
+  }
+
+  for (auto& value : narrow) { value += 1; }
+  mguid::scatter_strided(narrow.data(), reinterpret_cast<std::byte*>(&records[0].narrow),
+                         sizeof(Record), narrow.size());
+  for (std::size_t index{0}; index < records.size(); ++index) {
+    REQUIRE(records[index].narrow == index * 10 + 1);
+    REQUIRE(records[index].wide == index * 1000);
+  }
+}
+
+TEST_CASE("Transpose Rows To Columns") {
+  SECTION("Empty") {
+    const std::vector<Row> rows;
+    const auto columns = mguid::to_columns(rows);
+    REQUIRE(columns.empty());
+  }
+  SECTION("Every Column") {
+    // 37 rows exercise both the vector body and the scalar tail of the gathers
+    const auto rows = make_rows(37);
+    const auto columns = mguid::to_columns(rows);
+    REQUIRE(columns.size() == rows.size());
+    for (std::size_t index{0}; index < rows.size(); ++index) {
+      REQUIRE(columns.column<"id">()[index] == rows[index].get<"id">());
+      REQUIRE(columns.column<"ts">()[index] == rows[index].get<"ts">());
+      REQUIRE(columns.column<"flags">()[index] == rows[index].get<"flags">());
+      REQUIRE(columns.column<"price">()[index] == rows[index].get<"price">());
+      REQUIRE(columns.column<"qty">()[index] == rows[index].get<"qty">());
+      REQUIRE(columns.column<"symbol">()[index] == rows[index].get<"symbol">());
+    }
+  }
+  SECTION("Append") {
+    const auto rows = make_rows(10);
+    auto columns = mguid::to_columns(std::span{rows}.first(4));
+    mguid::to_columns(std::span<const Row>{rows}.subspan(4), columns);
+    REQUIRE(columns.size() == rows.size());
+    REQUIRE(columns.column<"ts">()[3] == rows[3].get<"ts">());
+    REQUIRE(columns.column<"ts">()[9] == rows[9].get<"ts">());
+    REQUIRE(columns.column<"symbol">()[4] == "4");
+  }
+  SECTION("Multiple Blocks") {
+    const auto rows = make_rows(mguid::kTransposeBlockRows * 2 + 3);
+    const auto columns = mguid::to_columns(rows);
+    REQUIRE(columns.size() == rows.size());
+    REQUIRE(columns.column<"ts">().back() == rows.back().get<"ts">());
+    REQUIRE(columns.column<"symbol">().back() == rows.back().get<"symbol">());
+    REQUIRE(mguid::from_columns(columns) == rows);
+  }
+}
+
+TEST_CASE("Transpose Columns To Rows") {
+  const auto rows = make_rows(29);
+  const auto columns = mguid::to_columns(rows);
+
+  SECTION("Round Trip") { REQUIRE(mguid::from_columns(columns) == rows); }
+  SECTION("Into Shorter Span") {
+    std::vector<Row> out(5);
+    REQUIRE(mguid::from_columns(columns, std::span{out}) == 5);
+    REQUIRE(std::equal(out.begin(), out.end(), rows.begin()));
+  }
+  SECTION("Into Longer Span") {
+    std::vector<Row> out(40);
+    REQUIRE(mguid::from_columns(columns, std::span{out}) == rows.size());
+    REQUIRE(std::equal(rows.begin(), rows.end(), out.begin()));
+    REQUIRE(out.back() == Row{});
+  }
+}
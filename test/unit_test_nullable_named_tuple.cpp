@@ -0,0 +1,132 @@
+#include "NullableNamedTuple.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+using Sparse = mguid::NullableNamedTuple<mguid::NamedType<"id", std::uint32_t>,
+                                         mguid::NamedType<"price", double>,
+                                         mguid::NamedType<"flag", char>,
+                                         mguid::NamedType<"qty", std::int16_t>>;
+
+TEST_CASE("NullableNamedTuple Layout") {
+  using Optionals = mguid::NamedTuple<mguid::NamedType<"id", std::optional<std::uint32_t>>,
+                                      mguid::NamedType<"price", std::optional<double>>,
+                                      mguid::NamedType<"flag", std::optional<char>>,
+                                      mguid::NamedType<"qty", std::optional<std::int16_t>>>;
+  STATIC_REQUIRE(sizeof(Sparse) < sizeof(Optionals));
+  STATIC_REQUIRE(std::is_same_v<Sparse::Word, std::uint8_t>);
+  STATIC_REQUIRE(Sparse::kWordCount == 1);
+}
+
+TEST_CASE("NullableNamedTuple Presence") {
+  SECTION("Default Is Empty") {
+    constexpr Sparse nt;
+    STATIC_REQUIRE(nt.none());
+    STATIC_REQUIRE(!nt.has<"id">());
+    STATIC_REQUIRE(nt.count_present() == 0);
+    REQUIRE(nt.get_if<"price">() == nullptr);
+  }
+  SECTION("From NamedTuple Is Full") {
+    const Sparse nt{Sparse::Values::Unpacked{1U, 2.5, 'x', std::int16_t{3}}};
+    REQUIRE(nt.all());
+    REQUIRE(nt.count_present() == 4);
+    REQUIRE(*nt.get_if<"price">() == 2.5);
+  }
+  SECTION("Set And Reset") {
+    Sparse nt;
+    nt.set<"price">(4.5);
+    nt.set<"qty">(std::int16_t{7});
+    REQUIRE(nt.has<"price">());
+    REQUIRE(nt.has<"qty">());
+    REQUIRE(!nt.has<"id">());
+    REQUIRE(nt.count_present() == 2);
+    REQUIRE(nt.bitmap()[0] == 0b1010);
+    REQUIRE(nt.value_or<"id">(9) == 9U);
+    REQUIRE(nt.value_or<"qty">(9) == 7);
+
+    *nt.get_if<"price">() = 5.5;
+    REQUIRE(nt.values().get<"price">() == 5.5);
+
+    nt.reset<"price">();
+    REQUIRE(!nt.has<"price">());
+    REQUIRE(nt.values().get<"price">() == 0.0);
+    nt.reset();
+    REQUIRE(nt.none());
+  }
+  SECTION("Large Bitmap") {
+    using Wide = mguid::NullableNamedTuple<
+        mguid::NamedType<"a0", char>, mguid::NamedType<"a1", char>, mguid::NamedType<"a2", char>,
+        mguid::NamedType<"a3", char>, mguid::NamedType<"a4", char>, mguid::NamedType<"a5", char>,
+        mguid::NamedType<"a6", char>, mguid::NamedType<"a7", char>, mguid::NamedType<"a8", char>>;
+    STATIC_REQUIRE(std::is_same_v<Wide::Word, std::uint16_t>);
+    Wide nt;
+    nt.set<"a8">('z');
+    nt.set<"a0">('a');
+    REQUIRE(nt.count_present() == 2);
+    REQUIRE(nt.bitmap()[0] == 0x101);
+  }
+  SECTION("Count Present In Rows") {
+    std::vector<Sparse> rows(10);
+    for (std::size_t index{0}; index < rows.size(); index += 3) {
+      rows[index].set<"id">(static_cast<std::uint32_t>(index));
+    }
+    REQUIRE(mguid::count_present<"id">(rows) == 4);
+    REQUIRE(mguid::count_present<"price">(rows) == 0);
+  }
+}
+
+TEST_CASE("NullableNamedTuple Comparison") {
+  Sparse lhs;
+  Sparse rhs;
+  REQUIRE(lhs == rhs);
+  REQUIRE((lhs <=> rhs) == std::partial_ordering::equivalent);
+
+  lhs.set<"price">(1.0);
+  REQUIRE(lhs != rhs);
+  REQUIRE(rhs < lhs);
+
+  rhs.set<"price">(2.0);
+  REQUIRE(lhs < rhs);
+
+  rhs.set<"price">(1.0);
+  REQUIRE(lhs == rhs);
+
+  rhs.set<"id">(0U);
+  REQUIRE(lhs < rhs);
+  REQUIRE(lhs != rhs);
+}
+
+TEST_CASE("NullableNamedTuple Serialization") {
+  Sparse nt;
+  nt.set<"id">(42U);
+  nt.set<"flag">('q');
+
+  std::array<std::byte, mguid::serialized_size_v<Sparse>> buffer{};
+  STATIC_REQUIRE(buffer.size() == sizeof(std::uint64_t) + 1 + 4 + 8 + 1 + 2);
+  REQUIRE(mguid::serialize(nt, std::span{buffer}) == buffer.size());
+
+  SECTION("Round Trip") {
+    const auto result = mguid::deserialize<Sparse>(buffer);
+    REQUIRE(result.has_value());
+    REQUIRE(*result == nt);
+    REQUIRE(!result->has<"price">());
+  }
+  SECTION("Rejects Plain NamedTuple Records") {
+    std::array<std::byte, mguid::serialized_size_v<Sparse::Values::Unpacked>> plain{};
+    REQUIRE(mguid::serialize(Sparse::Values::Unpacked{}, std::span{plain}) == plain.size());
+    Sparse out;
+    out.set<"qty">(std::int16_t{1});
+    REQUIRE(!mguid::deserialize(plain, out));
+    REQUIRE(out.has<"qty">());
+  }
+  SECTION("Truncated") {
+    REQUIRE(!mguid::deserialize<Sparse>(std::span{buffer}.first(buffer.size() - 1)).has_value());
+  }
+}
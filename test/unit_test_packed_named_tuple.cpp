@@ -0,0 +1,92 @@
+#include "PackedNamedTuple.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+using Unpacked =
+    mguid::NamedTuple<mguid::NamedType<"flag", char>, mguid::NamedType<"price", double>,
+                      mguid::NamedType<"qty", std::int32_t>, mguid::NamedType<"side", char>>;
+using Packed =
+    mguid::PackedNamedTuple<mguid::NamedType<"flag", char>, mguid::NamedType<"price", double>,
+                            mguid::NamedType<"qty", std::int32_t>, mguid::NamedType<"side", char>>;
+
+TEST_CASE("PackedNamedTuple Layout") {
+  SECTION("Smaller Than Declared Order") { REQUIRE(sizeof(Packed) < sizeof(Unpacked)); }
+  SECTION("No Interior Padding") { REQUIRE(sizeof(Packed) == 16); }
+  SECTION("Storage Order") {
+    REQUIRE(Packed::storage_index(1) == 0);
+    REQUIRE(Packed::storage_index(2) == 1);
+    REQUIRE(Packed::storage_index(0) == 2);
+    REQUIRE(Packed::storage_index(3) == 3);
+  }
+}
+
+TEST_CASE("PackedNamedTuple Declared Order Interface") {
+  Packed packed{'f', 1.5, 42, 's'};
+
+  SECTION("Tuple Size") { REQUIRE(std::tuple_size_v<Packed> == 4); }
+  SECTION("Tuple Element") {
+    REQUIRE(std::is_same_v<std::tuple_element_t<0, Packed>, char>);
+    REQUIRE(std::is_same_v<std::tuple_element_t<1, Packed>, double>);
+    REQUIRE(std::is_same_v<std::tuple_element_t<2, Packed>, std::int32_t>);
+    REQUIRE(std::is_same_v<std::tuple_element_t<3, Packed>, char>);
+  }
+  SECTION("Get By Tag") {
+    REQUIRE(packed.get<"flag">() == 'f');
+    REQUIRE(packed.get<"price">() == 1.5);
+    REQUIRE(packed.get<"qty">() == 42);
+    REQUIRE(packed.get<"side">() == 's');
+    REQUIRE(mguid::get<"qty">(packed) == 42);
+  }
+  SECTION("Get By Index") {
+    REQUIRE(packed.get<0>() == 'f');
+    REQUIRE(packed.get<1>() == 1.5);
+    REQUIRE(packed.get<2>() == 42);
+    REQUIRE(packed.get<3>() == 's');
+  }
+  SECTION("Set") {
+    packed.set<"qty">(7);
+    REQUIRE(packed.get<"qty">() == 7);
+  }
+  SECTION("Structured Bindings") {
+    auto& [flag, price, qty, side] = packed;
+    REQUIRE(flag == 'f');
+    REQUIRE(price == 1.5);
+    REQUIRE(qty == 42);
+    REQUIRE(side == 's');
+  }
+}
+
+TEST_CASE("PackedNamedTuple Conversion") {
+  SECTION("From NamedTuple") {
+    const Unpacked unpacked{'a', 2.0, 3, 'b'};
+    const Packed packed{unpacked};
+    REQUIRE(packed == unpacked);
+    REQUIRE(packed.to_tuple() == unpacked);
+  }
+  SECTION("Move Elements") {
+    using Strings = mguid::PackedNamedTuple<mguid::NamedType<"name", std::string>,
+                                            mguid::NamedType<"id", std::int8_t>>;
+    Strings strings{std::string(64, 'x'), std::int8_t{1}};
+    auto unpacked = std::move(strings).to_tuple();
+    REQUIRE(unpacked.get<"name">() == std::string(64, 'x'));
+  }
+}
+
+TEST_CASE("PackedNamedTuple Comparison") {
+  const Packed lhs{'a', 1.0, 1, 'a'};
+  const Packed rhs{'a', 1.0, 2, 'a'};
+  const Unpacked unpacked{'a', 1.0, 2, 'a'};
+
+  REQUIRE(lhs == lhs);
+  REQUIRE(lhs != rhs);
+  REQUIRE(lhs < rhs);
+  REQUIRE(rhs > lhs);
+  REQUIRE(rhs == unpacked);
+  REQUIRE(lhs < unpacked);
+  REQUIRE(unpacked == rhs);
+}
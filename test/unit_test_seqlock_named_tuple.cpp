@@ -0,0 +1,97 @@
+#include "SeqlockNamedTuple.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using SharedBook = mguid::SeqlockNamedTuple<
+    mguid::NamedType<"seq", std::uint64_t>, mguid::NamedType<"bid", double>,
+    mguid::NamedType<"ask", double>, mguid::NamedType<"side", char>,
+    mguid::NamedType<"qty", std::int32_t>>;
+using Book = SharedBook::Snapshot;
+
+TEST_CASE("Seqlock NamedTuple") {
+  SECTION("Initial Record") {
+    const SharedBook book{Book{1U, 99.5, 100.5, 'B', 7}};
+    REQUIRE(book.load() == Book{1U, 99.5, 100.5, 'B', 7});
+    REQUIRE(book.load<"side">() == 'B');
+    REQUIRE(book.version() == 1);
+  }
+  SECTION("Store And Publish") {
+    SharedBook book{};
+    REQUIRE(book.load() == Book{});
+    book.store(Book{2U, 1.0, 2.0, 'S', 3});
+    book.publish([](Book& record) {
+      record.get<"bid">() = 1.5;
+      record.get<"qty">() += 1;
+    });
+    REQUIRE(book.load() == Book{2U, 1.5, 2.0, 'S', 4});
+    REQUIRE(book.version() == 3);
+    Book copy{};
+    REQUIRE(book.try_load(copy));
+    REQUIRE(copy == book.load());
+  }
+  SECTION("Throwing Writer Publishes Nothing") {
+    SharedBook book{Book{1U, 99.5, 100.5, 'B', 7}};
+    const auto rejected = [](Book& record) {
+      record.get<"qty">() = 8;
+      throw std::runtime_error{"rejected"};
+    };
+    REQUIRE_THROWS_AS(book.publish(rejected), std::runtime_error);
+    REQUIRE(book.version() == 1);
+    book.publish([](Book& record) { record.get<"bid">() = 99.0; });
+    REQUIRE(book.load() == Book{1U, 99.0, 100.5, 'B', 7});
+  }
+}
+
+TEST_CASE("Seqlock NamedTuple Readers See Consistent Records") {
+  using SharedWide = mguid::SeqlockNamedTuple<
+      mguid::NamedType<"a", std::uint64_t>, mguid::NamedType<"b", std::uint64_t>,
+      mguid::NamedType<"c", std::uint32_t>, mguid::NamedType<"d", std::uint16_t>,
+      mguid::NamedType<"e", std::uint64_t>>;
+  using Wide = SharedWide::Snapshot;
+  SharedWide shared{};
+  constexpr std::uint64_t kPublications{20'000};
+  constexpr std::size_t kReaders{3};
+  std::atomic<bool> done{false};
+  std::atomic<std::size_t> torn{0};
+
+  std::vector<std::thread> readers{};
+  for (std::size_t reader{0}; reader < kReaders; ++reader) {
+    readers.emplace_back([&shared, &done, &torn] {
+      std::uint64_t last{0};
+      while (!done.load(std::memory_order_acquire)) {
+        const Wide record = shared.load();
+        // every publication writes the same counter into every element
+        const std::uint64_t value{record.get<"a">()};
+        if (record.get<"b">() != value || record.get<"c">() != static_cast<std::uint32_t>(value) ||
+            record.get<"d">() != static_cast<std::uint16_t>(value) || record.get<"e">() != value ||
+            value < last) {
+          torn.fetch_add(1);
+        }
+        last = value;
+      }
+    });
+  }
+
+  for (std::uint64_t value{1}; value <= kPublications; ++value) {
+    shared.publish([value](Wide& record) {
+      record.get<"a">() = value;
+      record.get<"b">() = value;
+      record.get<"c">() = static_cast<std::uint32_t>(value);
+      record.get<"d">() = static_cast<std::uint16_t>(value);
+      record.get<"e">() = value;
+    });
+  }
+  done.store(true, std::memory_order_release);
+  for (auto& reader : readers) { reader.join(); }
+
+  REQUIRE(torn.load() == 0);
+  REQUIRE(shared.load<"e">() == kPublications);
+  REQUIRE(shared.version() == kPublications + 1);
+}
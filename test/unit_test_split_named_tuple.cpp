@@ -0,0 +1,180 @@
+#include "SplitNamedTuple.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using Wide = mguid::NamedTuple<mguid::NamedType<"id", std::uint64_t>,
+                               mguid::NamedType<"price", double>,
+                               mguid::NamedType<"venue", std::pmr::string>,
+                               mguid::NamedType<"flags", std::array<std::uint64_t, 8>>,
+                               mguid::NamedType<"qty", int>>;
+using Split = mguid::SplitNamedTuple<
+    mguid::HotTags<"qty", "price">, mguid::NamedType<"id", std::uint64_t>,
+    mguid::NamedType<"price", double>, mguid::NamedType<"venue", std::pmr::string>,
+    mguid::NamedType<"flags", std::array<std::uint64_t, 8>>, mguid::NamedType<"qty", int>>;
+
+namespace {
+// counts the allocations made through it before passing them on to the default resource
+class CountingResource : public std::pmr::memory_resource {
+public:
+  std::size_t allocations{0};
+
+private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++allocations;
+    return std::pmr::get_default_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+    std::pmr::get_default_resource()->deallocate(ptr, bytes, alignment);
+  }
+
+  [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+}  // namespace
+
+TEST_CASE("Split Layout") {
+  STATIC_REQUIRE(
+      std::is_same_v<Split::HotTuple, mguid::NamedTuple<mguid::NamedType<"price", double>,
+                                                        mguid::NamedType<"qty", int>>>);
+  STATIC_REQUIRE(
+      std::is_same_v<Split::ColdTuple,
+                     mguid::NamedTuple<mguid::NamedType<"id", std::uint64_t>,
+                                       mguid::NamedType<"venue", std::pmr::string>,
+                                       mguid::NamedType<"flags", std::array<std::uint64_t, 8>>>>);
+  STATIC_REQUIRE(sizeof(Split) == sizeof(Split::HotTuple) + 2 * sizeof(void*));
+  STATIC_REQUIRE(sizeof(Split) < sizeof(Wide));
+  STATIC_REQUIRE(std::tuple_size_v<Split> == 5);
+  STATIC_REQUIRE(std::is_same_v<std::tuple_element_t<2, Split>, std::pmr::string>);
+}
+
+TEST_CASE("Split Lazy Cold Block") {
+  CountingResource resource;
+  Split split{&resource};
+  const Split& const_split = split;
+  REQUIRE_FALSE(split.cold_loaded());
+
+  SECTION("Hot Elements Do Not Load") {
+    split.set<"price">(1.5);
+    split.get<"qty">() = 3;
+    REQUIRE(const_split.get<"price">() == 1.5);
+    REQUIRE(const_split.get<"qty">() == 3);
+    REQUIRE_FALSE(split.cold_loaded());
+    REQUIRE(resource.allocations == 0);
+  }
+  SECTION("Const Reads Do Not Load") {
+    REQUIRE(const_split.get<"id">() == 0);
+    REQUIRE(const_split.get<"venue">().empty());
+    REQUIRE(const_split.cold() == Split::ColdTuple{});
+    REQUIRE_FALSE(split.cold_loaded());
+  }
+  SECTION("Set Loads") {
+    split.set<"venue">("XNAS");
+    REQUIRE(split.cold_loaded());
+    REQUIRE(const_split.get<"venue">() == "XNAS");
+    REQUIRE(const_split.get<"id">() == 0);
+    // the cold block and the string inside it both come from the resource
+    REQUIRE(split.get<"venue">().get_allocator().resource() == &resource);
+    REQUIRE(resource.allocations == 1);
+  }
+  SECTION("Get Loads") {
+    split.get<"id">() = 7;
+    REQUIRE(split.cold_loaded());
+    REQUIRE(const_split.get<"id">() == 7);
+  }
+}
+
+TEST_CASE("Split Construction") {
+  SECTION("From Values") {
+    const Split split{std::uint64_t{1}, 2.5, "XNYS", std::array<std::uint64_t, 8>{4}, 10};
+    REQUIRE(split.cold_loaded());
+    REQUIRE(split.get<"id">() == 1);
+    REQUIRE(split.get<"price">() == 2.5);
+    REQUIRE(split.get<"venue">() == "XNYS");
+    REQUIRE(split.get<"flags">()[0] == 4);
+    REQUIRE(split.get<"qty">() == 10);
+  }
+  SECTION("From Named Values") {
+    const Split split{mguid::NamedTypeV<"qty">(5), mguid::NamedTypeV<"id">(std::uint64_t{9})};
+    REQUIRE(split.get<"qty">() == 5);
+    REQUIRE(split.get<"id">() == 9);
+    REQUIRE(split.get<"price">() == 0.0);
+  }
+  SECTION("From Tuple") {
+    const Wide wide{std::uint64_t{3}, 1.0, "BATS", std::array<std::uint64_t, 8>{}, 2};
+    const Split split{wide};
+    REQUIRE(split.to_tuple() == wide);
+  }
+  SECTION("Structured Bindings") {
+    Split split{std::uint64_t{1}, 2.5, "XNYS", std::array<std::uint64_t, 8>{}, 10};
+    auto& [id, price, venue, flags, qty] = split;
+    REQUIRE(id == 1);
+    REQUIRE(venue == "XNYS");
+    qty = 11;
+    REQUIRE(split.get<"qty">() == 11);
+    REQUIRE(flags.size() == 8);
+    REQUIRE(price == 2.5);
+  }
+}
+
+TEST_CASE("Split Copy And Move") {
+  CountingResource resource;
+  Split original{Wide{std::uint64_t{1}, 2.0, "XNAS", std::array<std::uint64_t, 8>{}, 3},
+                 &resource};
+  REQUIRE(resource.allocations == 1);
+
+  SECTION("Copy") {
+    Split copy{original};
+    REQUIRE(copy == original);
+    copy.set<"venue">("XLON");
+    REQUIRE(original.get<"venue">() == "XNAS");
+    // like std::pmr containers the copy allocates from the default resource
+    REQUIRE(copy.get_allocator().resource() == std::pmr::get_default_resource());
+  }
+  SECTION("Copy Unloaded") {
+    const Split empty{};
+    const Split copy{empty};
+    REQUIRE_FALSE(copy.cold_loaded());
+    original = empty;
+    REQUIRE_FALSE(original.cold_loaded());
+    REQUIRE(original == empty);
+  }
+  SECTION("Move Takes Over The Cold Block") {
+    Split moved{std::move(original)};
+    REQUIRE(moved.get<"venue">() == "XNAS");
+    REQUIRE(moved.get_allocator().resource() == &resource);
+    REQUIRE(resource.allocations == 1);
+  }
+  SECTION("Move Assign From Another Resource") {
+    Split target{&resource};
+    Split source{Wide{std::uint64_t{2}, 4.0, "XLON", std::array<std::uint64_t, 8>{}, 6}};
+    target = std::move(source);
+    REQUIRE(target.get<"venue">() == "XLON");
+    REQUIRE(target.get_allocator().resource() == &resource);
+    REQUIRE(target.get<"venue">().get_allocator().resource() == &resource);
+  }
+}
+
+TEST_CASE("Split Comparison") {
+  const Split empty{};
+  Split loaded{};
+  loaded.get<"id">() = 0;
+  REQUIRE(loaded.cold_loaded());
+  REQUIRE(loaded == empty);
+
+  const Split lhs{std::uint64_t{1}, 2.0, "A", std::array<std::uint64_t, 8>{}, 3};
+  const Split rhs{std::uint64_t{1}, 2.0, "B", std::array<std::uint64_t, 8>{}, 0};
+  REQUIRE(lhs != rhs);
+  REQUIRE((lhs <=> rhs) == std::partial_ordering::less);
+  REQUIRE((empty <=> lhs) == std::partial_ordering::less);
+}